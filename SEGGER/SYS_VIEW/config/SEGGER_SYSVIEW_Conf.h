@@ -78,6 +78,10 @@ Additional information:
 #define SEGGER_SYSVIEW_POST_MORTEM_MODE SYSTEM_VIEW_POSTMORTEM
 #endif
 
+#ifdef SYSTEM_VIEW_BUFFER_SIZE
+#define SEGGER_SYSVIEW_RTT_BUFFER_SIZE SYSTEM_VIEW_BUFFER_SIZE
+#endif
+
 /*********************************************************************
  * TODO: Add your defines here.                                       *
  **********************************************************************
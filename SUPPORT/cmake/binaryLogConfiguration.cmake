@@ -0,0 +1,13 @@
+cmake_minimum_required(VERSION 3.16 FATAL_ERROR)
+
+#------------------------------------------------------------------------------#
+#  Bytes of the binary log kept for the reader. It is the RTT up buffer of the
+#  log on a target with RTT, else the ring drained by BinaryLog::read, which
+#  has to be a power of two.
+#------------------------------------------------------------------------------#
+
+if (NOT DEFINED RTOS_LOG_BUFFER_SIZE)
+set (RTOS_LOG_BUFFER_SIZE 4096 CACHE INTERNAL "Size of the binary log buffer.")
+endif()
+
+# End of cmake-file.
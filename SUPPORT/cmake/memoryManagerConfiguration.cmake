@@ -0,0 +1,41 @@
+cmake_minimum_required(VERSION 3.16 FATAL_ERROR)
+
+#------------------------------------------------------------------------------#
+#  Fixed size pools of the memory manager. A pool with a count of 0 is not
+#  used and the requests go to the RTOS heap. The pools are outside of the
+#  configTOTAL_HEAP_SIZE. Size classes have to be in the ascending order.
+#------------------------------------------------------------------------------#
+
+if (NOT DEFINED RTOS_MEM_TASK_CB_POOL_COUNT)
+set (RTOS_MEM_TASK_CB_POOL_COUNT 0 CACHE INTERNAL "Number of pooled task CBs.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_QUEUE_CB_POOL_COUNT)
+set (RTOS_MEM_QUEUE_CB_POOL_COUNT 0 CACHE INTERNAL "Number of pooled queue and semaphore CBs.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_SMALL_BLOCK_SIZE)
+set (RTOS_MEM_SMALL_BLOCK_SIZE 32 CACHE INTERNAL "Bytes in a small block.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_SMALL_BLOCK_COUNT)
+set (RTOS_MEM_SMALL_BLOCK_COUNT 0 CACHE INTERNAL "Number of small blocks.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_MEDIUM_BLOCK_SIZE)
+set (RTOS_MEM_MEDIUM_BLOCK_SIZE 128 CACHE INTERNAL "Bytes in a medium block.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_MEDIUM_BLOCK_COUNT)
+set (RTOS_MEM_MEDIUM_BLOCK_COUNT 0 CACHE INTERNAL "Number of medium blocks.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_LARGE_BLOCK_SIZE)
+set (RTOS_MEM_LARGE_BLOCK_SIZE 512 CACHE INTERNAL "Bytes in a large block.")
+endif()
+
+if (NOT DEFINED RTOS_MEM_LARGE_BLOCK_COUNT)
+set (RTOS_MEM_LARGE_BLOCK_COUNT 0 CACHE INTERNAL "Number of large blocks.")
+endif()
+
+# End of cmake-file.
@@ -22,4 +22,17 @@ if (NOT DEFINED SYSTEM_VIEW_POSTMORTEM)
 set (SYSTEM_VIEW_POSTMORTEM 0 CACHE INTERNAL "SYS_VIEW Postmortem mode flag.")
 endif()
 
+# The simulators keep a long post-mortem recording, the targets the default.
+if (NOT DEFINED SYSTEM_VIEW_BUFFER_SIZE)
+  if (PORT_SELECT STREQUAL "WIN_SIM" OR PORT_SELECT STREQUAL "POSIX_SIM")
+    set (SYSTEM_VIEW_BUFFER_SIZE 1048576 CACHE INTERNAL "SYS_VIEW RTT up buffer size.")
+  else()
+    set (SYSTEM_VIEW_BUFFER_SIZE 1024 CACHE INTERNAL "SYS_VIEW RTT up buffer size.")
+  endif()
+endif()
+
+if (NOT DEFINED SYSTEM_VIEW_DUMP_FILE)
+set (SYSTEM_VIEW_DUMP_FILE "SystemView.SVDat" CACHE INTERNAL "Post-mortem trace file of the simulators.")
+endif()
+
 # End of cmake-file.
\ No newline at end of file
@@ -0,0 +1,12 @@
+cmake_minimum_required(VERSION 3.16 FATAL_ERROR)
+
+#------------------------------------------------------------------------------#
+#  Size of the thread registry. Every constructed Thread takes a slot, the
+#  threads beyond this count are not visible to the registry services.
+#------------------------------------------------------------------------------#
+
+if (NOT DEFINED RTOS_MAX_THREADS)
+set (RTOS_MAX_THREADS 16 CACHE INTERNAL "Number of slots in the thread registry.")
+endif()
+
+# End of cmake-file.
@@ -0,0 +1,30 @@
+cmake_minimum_required(VERSION 3.16 FATAL_ERROR)
+
+#------------------------------------------------------------------------------#
+#  The unit tests link a copy of the wrappers of their own, in which the pools
+#  of the memory manager get a few blocks. So the pooled paths and the
+#  fall-back to the heap are built and tested, while the other builds keep the
+#  pools of memoryManagerConfiguration.cmake.
+#------------------------------------------------------------------------------#
+
+if (NOT DEFINED RTOS_UT_MEM_TASK_CB_POOL_COUNT)
+set (RTOS_UT_MEM_TASK_CB_POOL_COUNT 2 CACHE INTERNAL "Number of pooled task CBs in the unit tests.")
+endif()
+
+if (NOT DEFINED RTOS_UT_MEM_QUEUE_CB_POOL_COUNT)
+set (RTOS_UT_MEM_QUEUE_CB_POOL_COUNT 2 CACHE INTERNAL "Number of pooled queue and semaphore CBs in the unit tests.")
+endif()
+
+if (NOT DEFINED RTOS_UT_MEM_SMALL_BLOCK_COUNT)
+set (RTOS_UT_MEM_SMALL_BLOCK_COUNT 4 CACHE INTERNAL "Number of small blocks in the unit tests.")
+endif()
+
+if (NOT DEFINED RTOS_UT_MEM_MEDIUM_BLOCK_COUNT)
+set (RTOS_UT_MEM_MEDIUM_BLOCK_COUNT 4 CACHE INTERNAL "Number of medium blocks in the unit tests.")
+endif()
+
+if (NOT DEFINED RTOS_UT_MEM_LARGE_BLOCK_COUNT)
+set (RTOS_UT_MEM_LARGE_BLOCK_COUNT 2 CACHE INTERNAL "Number of large blocks in the unit tests.")
+endif()
+
+# End of cmake-file.
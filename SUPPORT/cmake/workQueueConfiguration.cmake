@@ -0,0 +1,12 @@
+cmake_minimum_required(VERSION 3.16 FATAL_ERROR)
+
+#------------------------------------------------------------------------------#
+#  Bytes a WorkQueue job keeps its callable in. Every queued job takes this
+#  size plus a function pointer, so it is kept to a few captured values.
+#------------------------------------------------------------------------------#
+
+if (NOT DEFINED RTOS_JOB_STORAGE_SIZE)
+set (RTOS_JOB_STORAGE_SIZE 16 CACHE INTERNAL "Size of the callable of a job.")
+endif()
+
+# End of cmake-file.
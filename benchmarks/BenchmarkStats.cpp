@@ -0,0 +1,102 @@
+/**
+ * @file        BenchmarkStats.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Collects the benchmark samples and reports their percentiles.
+ * @version     0.1
+ * @date        2021-08-01
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "BenchmarkStats.hpp"
+
+#include "FreeRTOS.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace BENCH {
+
+namespace {
+/* Nearest rank percentile of the sorted samples. */
+uint64_t percentile(uint64_t const *const pSorted, size_t const count,
+                    size_t const percent) {
+  size_t const rank = (percent * count + 99U) / 100U;
+  return pSorted[(rank > 0U) ? (rank - 1U) : 0U];
+}
+} // namespace
+
+uint64_t now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+summary_s Samples::summarise(char const *const name) {
+  summary_s summary = {};
+  summary.name = name;
+  summary.samples = m_count;
+  if (m_count > 0U) {
+    std::sort(&m_samples[0], &m_samples[m_count]);
+
+    uint64_t total = 0U;
+    for (size_t index = 0U; index < m_count; ++index) {
+      total += m_samples[index];
+    }
+    summary.min = m_samples[0];
+    summary.p50 = percentile(m_samples, m_count, 50U);
+    summary.p90 = percentile(m_samples, m_count, 90U);
+    summary.p99 = percentile(m_samples, m_count, 99U);
+    summary.max = m_samples[m_count - 1U];
+    summary.mean = static_cast<double>(total) / static_cast<double>(m_count);
+    summary.ops_per_s = (summary.mean > 0.0) ? (1.0e9 / summary.mean) : 0.0;
+  }
+  return summary;
+}
+
+void Reporter::begin() {
+  if (m_format == format_e::eJson) {
+    std::printf("{\n  \"platform\": \"posix_sim\",\n  \"tick_hz\": %lu,\n"
+                "  \"unit\": \"ns\",\n  \"results\": [",
+                static_cast<unsigned long>(configTICK_RATE_HZ));
+  } else {
+    std::printf("name,samples,min,p50,p90,p99,max,mean,ops_per_s\n");
+  }
+}
+
+void Reporter::report(summary_s const &rSummary) {
+  if (m_format == format_e::eJson) {
+    std::printf("%s\n    {\"name\": \"%s\", \"samples\": %zu, \"min\": %llu, "
+                "\"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"max\": %llu, "
+                "\"mean\": %.1f, \"ops_per_s\": %.1f}",
+                (m_count > 0U) ? "," : "", rSummary.name, rSummary.samples,
+                static_cast<unsigned long long>(rSummary.min),
+                static_cast<unsigned long long>(rSummary.p50),
+                static_cast<unsigned long long>(rSummary.p90),
+                static_cast<unsigned long long>(rSummary.p99),
+                static_cast<unsigned long long>(rSummary.max), rSummary.mean,
+                rSummary.ops_per_s);
+  } else {
+    std::printf("%s,%zu,%llu,%llu,%llu,%llu,%llu,%.1f,%.1f\n", rSummary.name,
+                rSummary.samples,
+                static_cast<unsigned long long>(rSummary.min),
+                static_cast<unsigned long long>(rSummary.p50),
+                static_cast<unsigned long long>(rSummary.p90),
+                static_cast<unsigned long long>(rSummary.p99),
+                static_cast<unsigned long long>(rSummary.max), rSummary.mean,
+                rSummary.ops_per_s);
+  }
+  ++m_count;
+}
+
+void Reporter::end() {
+  if (m_format == format_e::eJson) {
+    std::printf("\n  ]\n}\n");
+  }
+  (void)std::fflush(stdout);
+}
+
+} // namespace BENCH
@@ -0,0 +1,91 @@
+/**
+ * @file        BenchmarkStats.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Collects the benchmark samples and reports their percentiles.
+ * @version     0.1
+ * @date        2021-08-01
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_BENCHMARK_STATS_HPP
+#define RTOS_BENCHMARK_STATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace BENCH {
+
+constexpr size_t MAX_SAMPLES = 2000U; /**< Samples kept per benchmark. */
+
+/**
+ * @brief   Time on the host clock in nano seconds.
+ */
+uint64_t now_ns();
+
+/**
+ * @brief   Summary of the samples of a single benchmark, in nano seconds.
+ */
+struct summary_s {
+  char const *name;  /**< Name of the benchmark.                 */
+  size_t samples;    /**< Number of samples taken.               */
+  uint64_t min;      /**< Fastest sample.                        */
+  uint64_t p50;      /**< Median.                                */
+  uint64_t p90;      /**< 90th percentile.                       */
+  uint64_t p99;      /**< 99th percentile.                       */
+  uint64_t max;      /**< Slowest sample.                        */
+  double mean;       /**< Average of the samples.                */
+  double ops_per_s;  /**< Operations per second at the mean.     */
+};
+
+/**
+ * @brief   Fixed set of samples. Samples past MAX_SAMPLES are dropped.
+ */
+class Samples {
+public:
+  Samples() : m_samples(), m_count(0U) {}
+
+  void clear() { m_count = 0U; }
+
+  void add(uint64_t const sample_ns) {
+    if (m_count < MAX_SAMPLES) {
+      m_samples[m_count++] = sample_ns;
+    }
+  }
+
+  /**
+   * @brief   Sorts the samples and summarises them.
+   */
+  summary_s summarise(char const *name);
+
+private:
+  uint64_t m_samples[MAX_SAMPLES]; /**< Samples in the order taken. */
+  size_t m_count;                  /**< Number of samples.          */
+};
+
+/**
+ * @brief   Output formats of the report.
+ */
+enum class format_e {
+  eJson, /**< A single JSON object with an array of results. */
+  eCsv,  /**< A header line and a line per result.            */
+};
+
+/**
+ * @brief   Writes the summaries to the standard output as they come.
+ */
+class Reporter {
+public:
+  explicit Reporter(format_e format) : m_format(format), m_count(0U) {}
+
+  void begin();
+  void report(summary_s const &rSummary);
+  void end();
+
+private:
+  format_e const m_format; /**< Output format.              */
+  size_t m_count;          /**< Number of results written.  */
+};
+} // namespace BENCH
+#endif // RTOS_BENCHMARK_STATS_HPP
@@ -0,0 +1,363 @@
+/**
+ * @file        Benchmarks.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Micro benchmarks of the wrapper primitives on the simulator.
+ * @version     0.1
+ * @date        2021-08-01
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+// Std
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+// RTOS
+#include <MemoryManager.hpp>
+#include <Mutex.hpp>
+#include <Semaphore.hpp>
+#include <TQueue.hpp>
+#include <Thread.hpp>
+
+// Benchmark
+#include "BenchmarkStats.hpp"
+
+using BENCH::now_ns;
+
+constexpr size_t ITERATIONS = 1000U;
+constexpr RTOS::priority_t PEER_PRIORITY = 2;
+constexpr RTOS::priority_t WAITER_PRIORITY = 3;
+constexpr RTOS::priority_t RUNNER_PRIORITY = 4;
+/* The peers only loop, the runner also formats the report. The peers are
+ * created by each benchmark and deleted at its end, so the heap holds the
+ * runner and at most two peers at a time. */
+constexpr RTOS::stack_size_t PEER_STACK_SIZE = configMINIMAL_STACK_SIZE;
+constexpr RTOS::stack_size_t RUNNER_STACK_SIZE = configMINIMAL_STACK_SIZE * 2;
+
+/* Shared by the benchmarks, they run one after the other. */
+static BENCH::Samples g_samples;
+static BENCH::Samples g_freeSamples;
+static RTOS::CountingSemaphore g_peersDone(4U);
+static std::atomic<bool> g_isStopRequested(false);
+static std::atomic<uint64_t> g_notifyStamp(0U);
+static int g_exitCode = 0;
+
+/**
+ * @brief   Thread that runs a function once and reports when it is done.
+ */
+class peer_thread : public RTOS::Thread {
+
+  void run() override {
+    m_pWork(m_isRecording);
+    (void)g_peersDone.release();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  using work_t = void (*)(bool isRecording);
+
+  peer_thread(RTOS::name_t const name, RTOS::priority_t const priority,
+              work_t const pWork, bool const isRecording)
+      : Thread(name, priority, PEER_STACK_SIZE), m_name(name), m_pWork(pWork),
+        m_isRecording(isRecording) {}
+
+  /**
+   * @brief   Checks the thread got its stack and TCB. A thread without them
+   * never runs, so waiting for it would hang the run.
+   */
+  bool is_created() const {
+    if (get_status() == RTOS::status_e::eMemoryAllocationFailed) {
+      (void)fprintf(stderr, "BENCHMARK: No memory for the thread %s\n",
+                    m_name);
+      return false;
+    }
+    return true;
+  }
+
+private:
+  RTOS::name_t const m_name;
+  work_t const m_pWork;
+  bool const m_isRecording;
+};
+
+/*------------------------- Context switch ---------------------------------*/
+
+/* Two threads of the same priority yield to each other, so a yield is a
+ * switch to the other thread and a switch back. */
+void yield_work(bool const isRecording) {
+  if (isRecording) {
+    for (size_t index = 0U; index < ITERATIONS; ++index) {
+      uint64_t const start = now_ns();
+      RTOS::Thread::yield();
+      g_samples.add(now_ns() - start);
+    }
+    g_isStopRequested = true;
+  } else {
+    while (!g_isStopRequested) {
+      RTOS::Thread::yield();
+    }
+  }
+}
+
+bool bench_yield(BENCH::Reporter &rReporter) {
+  peer_thread recorder("YieldRec", PEER_PRIORITY, yield_work, true);
+  peer_thread partner("YieldPeer", PEER_PRIORITY, yield_work, false);
+  if (!recorder.is_created() || !partner.is_created()) {
+    return false;
+  }
+
+  g_samples.clear();
+  g_isStopRequested = false;
+  recorder.join();
+  partner.join();
+  (void)g_peersDone.acquire();
+  (void)g_peersDone.acquire();
+  rReporter.report(g_samples.summarise("yield_round_trip"));
+  return true;
+}
+
+/*------------------------- Notify to wake ---------------------------------*/
+
+static RTOS::Thread *g_pNotifyWaiter = nullptr;
+
+/* The waiter has the higher priority, so the notify switches to it at once. */
+void notify_wait_work(bool const isRecording) {
+  (void)isRecording;
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    (void)RTOS::Thread::wait_for_value();
+    g_samples.add(now_ns() - g_notifyStamp);
+  }
+}
+
+void notify_send_work(bool const isRecording) {
+  (void)isRecording;
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    g_notifyStamp = now_ns();
+    (void)g_pNotifyWaiter->notify(
+        static_cast<RTOS::notify_value_t>(index),
+        RTOS::ISignal::NTF_TYP_E::eSetValueWithOverwrite);
+  }
+}
+
+bool bench_notify(BENCH::Reporter &rReporter) {
+  peer_thread waiter("NtfWaiter", WAITER_PRIORITY, notify_wait_work, true);
+  peer_thread sender("NtfSender", PEER_PRIORITY, notify_send_work, false);
+  if (!waiter.is_created() || !sender.is_created()) {
+    return false;
+  }
+
+  g_samples.clear();
+  g_pNotifyWaiter = &waiter;
+  waiter.join();
+  sender.join();
+  (void)g_peersDone.acquire();
+  (void)g_peersDone.acquire();
+  g_pNotifyWaiter = nullptr;
+  rReporter.report(g_samples.summarise("notify_to_wake"));
+  return true;
+}
+
+/*------------------------- Queue round trip -------------------------------*/
+
+template <size_t Size> struct payload_s {
+  uint8_t bytes[Size];
+};
+
+template <size_t Size> struct echo_queues_s {
+  static RTOS::TQueue<payload_s<Size>, 1> request;
+  static RTOS::TQueue<payload_s<Size>, 1> reply;
+};
+template <size_t Size>
+RTOS::TQueue<payload_s<Size>, 1> echo_queues_s<Size>::request;
+template <size_t Size>
+RTOS::TQueue<payload_s<Size>, 1> echo_queues_s<Size>::reply;
+
+/* Sends every request back as the reply. */
+template <size_t Size> void echo_work(bool const isRecording) {
+  (void)isRecording;
+  payload_s<Size> item;
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    echo_queues_s<Size>::request.dequeue(item);
+    echo_queues_s<Size>::reply.enqueue(item);
+  }
+}
+
+/* The runner sends a request and waits for the echo, two copies each way. */
+template <size_t Size>
+bool bench_queue(BENCH::Reporter &rReporter, char const *const name) {
+  peer_thread echo("QueueEcho", PEER_PRIORITY, echo_work<Size>, false);
+  if (!echo.is_created()) {
+    return false;
+  }
+
+  g_samples.clear();
+  echo.join();
+
+  payload_s<Size> item;
+  std::memset(&item, 0xA5, sizeof(item));
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    uint64_t const start = now_ns();
+    echo_queues_s<Size>::request.enqueue(item);
+    echo_queues_s<Size>::reply.dequeue(item);
+    g_samples.add(now_ns() - start);
+  }
+  (void)g_peersDone.acquire();
+  rReporter.report(g_samples.summarise(name));
+  return true;
+}
+
+/*------------------------- Mutex ------------------------------------------*/
+
+static RTOS::Mutex *g_pBenchMutex = nullptr;
+
+bool bench_mutex_uncontended(BENCH::Reporter &rReporter) {
+  RTOS::Mutex mutex;
+
+  g_samples.clear();
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    uint64_t const start = now_ns();
+    (void)mutex.lock(RTOS::wait_forever);
+    (void)mutex.unlock();
+    g_samples.add(now_ns() - start);
+  }
+  rReporter.report(g_samples.summarise("mutex_lock_unlock_uncontended"));
+  return true;
+}
+
+/* Each thread yields while holding the mutex and after releasing it, so every
+ * lock of the recorder finds the mutex held by the partner. */
+void mutex_work(bool const isRecording) {
+  RTOS::Mutex &rMutex = *g_pBenchMutex;
+  for (size_t index = 0U; isRecording ? (index < ITERATIONS)
+                                      : !g_isStopRequested.load();
+       ++index) {
+    uint64_t const start = now_ns();
+    (void)rMutex.lock(RTOS::wait_forever);
+    if (isRecording) {
+      g_samples.add(now_ns() - start);
+    }
+    RTOS::Thread::yield();
+    (void)rMutex.unlock();
+    RTOS::Thread::yield();
+  }
+  if (isRecording) {
+    g_isStopRequested = true;
+  }
+}
+
+bool bench_mutex_contended(BENCH::Reporter &rReporter) {
+  RTOS::Mutex mutex;
+  peer_thread recorder("MutexRec", PEER_PRIORITY, mutex_work, true);
+  peer_thread partner("MutexPeer", PEER_PRIORITY, mutex_work, false);
+  if (!recorder.is_created() || !partner.is_created()) {
+    return false;
+  }
+
+  g_samples.clear();
+  g_pBenchMutex = &mutex;
+  g_isStopRequested = false;
+  partner.join();
+  recorder.join();
+  (void)g_peersDone.acquire();
+  (void)g_peersDone.acquire();
+  g_pBenchMutex = nullptr;
+  rReporter.report(g_samples.summarise("mutex_lock_contended"));
+  return true;
+}
+
+/*------------------------- Memory manager ---------------------------------*/
+
+void bench_memory(BENCH::Reporter &rReporter, size_t const size,
+                  char const *const allocate_name,
+                  char const *const free_name) {
+  RTOS::MemoryManager &rManager = RTOS::MemoryManager::get_Instance();
+
+  g_samples.clear();
+  g_freeSamples.clear();
+  for (size_t index = 0U; index < ITERATIONS; ++index) {
+    void *pBlock = nullptr;
+    uint64_t const start = now_ns();
+    bool const isAllocated =
+        rManager.get_block(&pBlock, size) == RTOS::eMemAllocationSuccess;
+    uint64_t const allocated = now_ns();
+    if (isAllocated) {
+      RTOS::MemoryManager::release_block(pBlock);
+      g_freeSamples.add(now_ns() - allocated);
+      g_samples.add(allocated - start);
+    }
+  }
+  rReporter.report(g_samples.summarise(allocate_name));
+  rReporter.report(g_freeSamples.summarise(free_name));
+}
+
+/*------------------------- Runner -----------------------------------------*/
+
+class runner_thread : public RTOS::Thread {
+
+  void run() override {
+    BENCH::Reporter reporter(m_format);
+    reporter.begin();
+
+    /* A benchmark that cannot create its threads ends the run. */
+    bool const isComplete =
+        bench_yield(reporter) && bench_notify(reporter) &&
+        bench_queue<4>(reporter, "tqueue_round_trip_4B") &&
+        bench_queue<32>(reporter, "tqueue_round_trip_32B") &&
+        bench_queue<128>(reporter, "tqueue_round_trip_128B") &&
+        bench_queue<512>(reporter, "tqueue_round_trip_512B") &&
+        bench_mutex_uncontended(reporter) && bench_mutex_contended(reporter);
+
+    if (isComplete) {
+      bench_memory(reporter, 16U, "memory_allocate_16B", "memory_free_16B");
+      bench_memory(reporter, 128U, "memory_allocate_128B", "memory_free_128B");
+      bench_memory(reporter, 512U, "memory_allocate_512B", "memory_free_512B");
+    } else {
+      g_exitCode = 1;
+    }
+
+    reporter.end();
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit runner_thread(BENCH::format_e const format)
+      : Thread("Runner", RUNNER_PRIORITY, RUNNER_STACK_SIZE),
+        m_format(format) {}
+
+private:
+  BENCH::format_e const m_format;
+};
+
+/**
+ * @brief   Runs all the benchmarks and writes the results as JSON, or as CSV
+ * when started with --csv.
+ */
+int main(int argc, char **argv) {
+  BENCH::format_e const format =
+      ((argc > 1) && (std::strcmp(argv[1], "--csv") == 0))
+          ? BENCH::format_e::eCsv
+          : BENCH::format_e::eJson;
+
+  runner_thread runner(format);
+  if (runner.get_status() == RTOS::status_e::eMemoryAllocationFailed) {
+    (void)fprintf(stderr, "BENCHMARK: No memory for the runner\n");
+    return 1;
+  }
+  runner.join();
+  return g_exitCode;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
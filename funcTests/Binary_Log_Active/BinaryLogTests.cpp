@@ -0,0 +1,130 @@
+/**
+ * @file        BinaryLogTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Logs from two threads with the binary logger and saves the log
+ * for the host decoder.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+
+// RTOS
+#include <BinaryLog.hpp>
+#include <Thread.hpp>
+
+constexpr uint32_t LINES_PER_WORKER = 50U;
+constexpr uint32_t WORKER_COUNT = 2U;
+
+static std::atomic<uint32_t> g_workersDone(0U);
+
+enum class work_state_e : uint8_t { eIdle, eBusy };
+
+// APP Section:
+class worker_thread : public RTOS::Thread {
+
+  void run() override {
+    RTOS_LOG("worker %u started", m_number);
+    for (uint32_t line = 0U; line < LINES_PER_WORKER; ++line) {
+      RTOS_LOG("worker %u line %u state %d load %.2f", m_number, line,
+               work_state_e::eBusy, static_cast<float>(line) / 4.0F);
+      delay_ms(1);
+    }
+    RTOS_LOG("worker %u done, %llu units", m_number,
+             static_cast<uint64_t>(LINES_PER_WORKER) << 32U);
+    ++g_workersDone;
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  worker_thread(RTOS::name_t const name, uint32_t const number)
+      : Thread(name, 2, configMINIMAL_STACK_SIZE), m_number(number) {}
+
+private:
+  uint32_t const m_number;
+};
+
+/* Lowest priority, drains the log to the file while the workers are idle. */
+class drain_thread : public RTOS::Thread {
+
+  void run() override {
+    RTOS::BinaryLog &rLog = RTOS::BinaryLog::get_Instance();
+    FILE *const pFile = std::fopen("BinaryLog.bin", "wb");
+    uint8_t buffer[RTOS::LogFormat::MAX_FORMAT_SIZE];
+    size_t total = 0U;
+
+    bool isDone = false;
+    while (!isDone) {
+      isDone = (g_workersDone == WORKER_COUNT);
+      size_t length = 0U;
+      while ((length = rLog.read(buffer, sizeof(buffer))) > 0U) {
+        total += std::fwrite(buffer, 1U, length, pFile);
+      }
+      delay_ms(5);
+    }
+    (void)std::fclose(pFile);
+
+    std::cout << "Log bytes written: " << total << std::endl;
+    std::cout << "Dropped lines: " << rLog.get_dropped() << std::endl;
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  drain_thread() : Thread("Drain", 1, configMINIMAL_STACK_SIZE * 2) {}
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rDrain.join();
+    m_rFirst.join();
+    m_rSecond.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rDrain, Thread &rFirst, Thread &rSecond)
+      : Thread("MainThread", 3, configMINIMAL_STACK_SIZE), m_rDrain(rDrain),
+        m_rFirst(rFirst), m_rSecond(rSecond) {}
+
+private:
+  Thread &m_rDrain;
+  Thread &m_rFirst;
+  Thread &m_rSecond;
+};
+
+int main() {
+  drain_thread drain;
+  worker_thread first("WorkerOne", 1U);
+  worker_thread second("WorkerTwo", 2U);
+  main_thread main_th(drain, first, second);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -15,9 +15,20 @@
 // RTOS
 #include <Thread.hpp>
 
-void print_for_the_tick_rate(RTOS::delay_t const incomingDelay) {
-  std::cout << "A delay of " << incomingDelay << "ms is tranlated to ticks of "
-            << pdMS_TO_TICKS(incomingDelay) << std::endl;
+using namespace std::chrono_literals;
+using namespace RTOS::literals;
+
+/* The conversions are constexpr and have to be done by the compiler. */
+static_assert(RTOS::delay_t(1s).ticks() == configTICK_RATE_HZ);
+static_assert(RTOS::delay_t(1000) == RTOS::delay_t(1s));
+static_assert(RTOS::delay_t(-5ms).ticks() == 0U);
+static_assert(RTOS::delay_t(24h * 365 * 1000) == RTOS::wait_forever);
+static_assert((7_ticks).ticks() == 7U);
+
+void print_for_the_tick_rate(RTOS::delay_t const incomingDelay,
+                             const char *const pDescription) {
+  std::cout << "A delay of " << pDescription << " is tranlated to ticks of "
+            << incomingDelay.ticks() << std::endl;
 }
 
 int main() {
@@ -27,16 +38,24 @@ int main() {
             << " i.e once clock cycle is: "
             << (1 / static_cast<unsigned int>(configTICK_RATE_HZ)) << std::endl;
 
-  RTOS::delay_t delays[] = {100, 10, 12, 15, 255, 36.7, 89, 102};
+  uint32_t delays[] = {100, 10, 12, 15, 255, 36, 89, 102};
 
-  for (size_t index = 0; index < (sizeof(delays) / sizeof(RTOS::delay_t));
+  for (size_t index = 0; index < (sizeof(delays) / sizeof(uint32_t));
        index++) {
-    print_for_the_tick_rate(delays[index]);
+    std::cout << delays[index] << "ms: ";
+    print_for_the_tick_rate(delays[index], "integer milli-seconds");
   }
+
+  print_for_the_tick_rate(2s, "2s");
+  print_for_the_tick_rate(1500us, "1500us");
+  print_for_the_tick_rate(std::chrono::duration<float, std::milli>(36.7f),
+                          "36.7ms as float");
+  print_for_the_tick_rate(3_ticks, "3_ticks");
+  print_for_the_tick_rate(RTOS::wait_forever, "wait_forever");
 }
 
 void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
   printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
   while (1)
     ;
-}
\ No newline at end of file
+}
@@ -0,0 +1,125 @@
+/**
+ * @file        EventGroupTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the waits and the rendezvous of the event group.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <EventGroup.hpp>
+#include <Thread.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr RTOS::event_bits_t SENSOR_READY = 1U << 0U;
+constexpr RTOS::event_bits_t RADIO_READY = 1U << 1U;
+constexpr RTOS::event_bits_t ALL_READY = SENSOR_READY | RADIO_READY;
+
+constexpr RTOS::event_bits_t WAITER_AT_SYNC = 1U << 2U;
+constexpr RTOS::event_bits_t WORKER_AT_SYNC = 1U << 3U;
+constexpr RTOS::event_bits_t ALL_AT_SYNC = WAITER_AT_SYNC | WORKER_AT_SYNC;
+
+// APP Section:
+class worker_thread : public RTOS::Thread {
+
+  void run() override {
+    delay_ms(10);
+    (void)m_rEvents.set(SENSOR_READY);
+    delay_ms(10);
+    (void)m_rEvents.set(RADIO_READY);
+
+    std::cout << "Worker at sync: "
+              << m_rEvents.sync(WORKER_AT_SYNC, ALL_AT_SYNC, 1s) << std::endl;
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit worker_thread(RTOS::EventGroup &rEvents)
+      : Thread("Worker", 3, configMINIMAL_STACK_SIZE), m_rEvents(rEvents) {}
+
+private:
+  RTOS::EventGroup &m_rEvents;
+};
+
+class waiting_thread : public RTOS::Thread {
+
+  void run() override {
+    RTOS::event_bits_t bits = m_rEvents.wait_any(ALL_READY, 1s, false);
+    std::cout << "Any ready: " << (bits & ALL_READY) << std::endl;
+
+    bits = m_rEvents.wait_all(ALL_READY, 1s);
+    std::cout << "All ready: " << (bits & ALL_READY) << std::endl;
+    std::cout << "Bits left: " << m_rEvents.get() << std::endl;
+
+    bits = m_rEvents.wait_any(ALL_READY, 20ms);
+    std::cout << "Timed out: " << ((bits & ALL_READY) == 0U) << std::endl;
+
+    delay_ms(50);
+    std::cout << "Waiter at sync: "
+              << m_rEvents.sync(WAITER_AT_SYNC, ALL_AT_SYNC, 1s) << std::endl;
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit waiting_thread(RTOS::EventGroup &rEvents)
+      : Thread("Waiter", 2, configMINIMAL_STACK_SIZE), m_rEvents(rEvents) {}
+
+private:
+  RTOS::EventGroup &m_rEvents;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rWaiter.join();
+    m_rWorker.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rWorker, Thread &rWaiter)
+      : Thread("MainThread", 4, configMINIMAL_STACK_SIZE), m_rWorker(rWorker),
+        m_rWaiter(rWaiter) {}
+
+private:
+  Thread &m_rWorker;
+  Thread &m_rWaiter;
+};
+
+int main() {
+  RTOS::EventGroup events;
+  worker_thread worker(events);
+  waiting_thread waiter(events);
+  main_thread main_th(worker, waiter);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
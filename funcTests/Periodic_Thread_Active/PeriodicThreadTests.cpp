@@ -0,0 +1,89 @@
+/**
+ * @file        PeriodicThreadTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the periodic thread and its timing statistics.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <PeriodicThread.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr RTOS::stack_size_t TEST_STACK_DEPTH = configMINIMAL_STACK_SIZE * 2;
+
+// APP Section:
+class control_loop : public RTOS::PeriodicThread {
+
+  uint32_t m_runCount;
+
+  void run_period() override {
+    ++m_runCount;
+    /* Every 50th period takes longer than the period itself. */
+    if ((m_runCount % 50U) == 0U) {
+      TickType_t const start = xTaskGetTickCount();
+      while ((xTaskGetTickCount() - start) < 25U) {
+      }
+    }
+  }
+
+  void on_overrun(TickType_t const late_ticks) override {
+    std::cout << "Period " << m_runCount << " over-ran by " << late_ticks
+              << " ticks" << std::endl;
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  control_loop()
+      : PeriodicThread("Loop", 3, TEST_STACK_DEPTH, 10ms), m_runCount(0U) {}
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rLoop.join();
+    delay_ms(1s);
+
+    RTOS::period_stats_s const stats = m_rLoop.get_period_stats();
+    std::cout << "Periods: " << stats.period_count
+              << " overruns: " << stats.overrun_count
+              << " max jitter: " << stats.max_jitter << std::endl;
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit main_thread(control_loop &rLoop)
+      : Thread("MainThread", 2, TEST_STACK_DEPTH), m_rLoop(rLoop) {}
+
+private:
+  control_loop &m_rLoop;
+};
+
+int main() {
+  control_loop loop;
+  main_thread main_th(loop);
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
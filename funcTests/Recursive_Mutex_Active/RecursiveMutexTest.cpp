@@ -0,0 +1,123 @@
+/**
+ * @file        RecursiveMutexTest.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the recursive mutex re-entered by layered calls.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <RecursiveMutex.hpp>
+#include <ScopedLock.hpp>
+#include <Thread.hpp>
+
+using namespace std::chrono_literals;
+
+// APP Section:
+class layered_thread : public RTOS::Thread {
+
+  /* Both layers lock the mutex, the inner one while the outer holds it. */
+  void inner_layer(uint32_t const depth) {
+    RTOS::ScopedLock lock(m_rMutex);
+    std::cout << "Layer " << depth << " locked" << std::endl;
+    if (depth < 3U) {
+      inner_layer(depth + 1U);
+    }
+  }
+
+  void run() override {
+    {
+      RTOS::ScopedLock lock(m_rMutex);
+      inner_layer(1U);
+      /* Still held by the outer lock, the other thread keeps waiting. */
+      delay_ms(100);
+    }
+    std::cout << "Layered thread released the mutex" << std::endl;
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit layered_thread(RTOS::IMutex &rMutex)
+      : Thread("Layered", 2, configMINIMAL_STACK_SIZE), m_rMutex(rMutex) {}
+
+private:
+  RTOS::IMutex &m_rMutex;
+};
+
+class waiting_thread : public RTOS::Thread {
+
+  void run() override {
+    /* Let the layered thread take the mutex first. */
+    delay_ms(10);
+    RTOS::UniqueLock lock(m_rMutex, RTOS::try_to_lock);
+    std::cout << "Try lock while held: " << lock.owns_lock() << std::endl;
+
+    (void)lock.try_lock_for(1s);
+    std::cout << "Timed lock after release: " << lock.owns_lock()
+              << std::endl;
+    lock.unlock();
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit waiting_thread(RTOS::IMutex &rMutex)
+      : Thread("Waiting", 2, configMINIMAL_STACK_SIZE), m_rMutex(rMutex) {}
+
+private:
+  RTOS::IMutex &m_rMutex;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rLayered.join();
+    m_rWaiting.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rLayered, Thread &rWaiting)
+      : Thread("MainThread", 3, configMINIMAL_STACK_SIZE),
+        m_rLayered(rLayered), m_rWaiting(rWaiting) {}
+
+private:
+  Thread &m_rLayered;
+  Thread &m_rWaiting;
+};
+
+int main() {
+  RTOS::RecursiveMutex mutex;
+  layered_thread layered(mutex);
+  waiting_thread waiting(mutex);
+  main_thread main_th(layered, waiting);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file        RuntimeStatsTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the CPU usage reported for the threads.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <Thread.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr RTOS::stack_size_t TEST_STACK_DEPTH = configMINIMAL_STACK_SIZE * 2;
+
+// APP Section:
+class busy_thread : public RTOS::Thread {
+
+  void run() override {
+    for (;;) {
+      /* Busy for 3 ticks then sleep for 7, roughly 30% load. */
+      TickType_t const start = xTaskGetTickCount();
+      while ((xTaskGetTickCount() - start) < 3U) {
+      }
+      delay_ms(7);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  busy_thread() : Thread("Busy", 2, TEST_STACK_DEPTH) {}
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rBusy.join();
+    delay_ms(2s);
+
+    RTOS::runtime_stats_s const stats = m_rBusy.get_runtime_stats();
+    std::cout << "Busy thread load: "
+              << static_cast<unsigned>(stats.load_percent)
+              << "% switches: " << stats.context_switches << std::endl;
+
+    RTOS::RuntimeSnapshot<8> snapshot;
+    if (snapshot.capture()) {
+      for (RTOS::thread_runtime_s const &rThread : snapshot) {
+        std::cout << rThread.name << ": "
+                  << static_cast<unsigned>(rThread.stats.load_percent) << "%"
+                  << std::endl;
+      }
+    }
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit main_thread(busy_thread &rBusy)
+      : Thread("MainThread", 3, TEST_STACK_DEPTH), m_rBusy(rBusy) {}
+
+private:
+  busy_thread &m_rBusy;
+};
+
+int main() {
+  busy_thread busy;
+  main_thread main_th(busy);
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
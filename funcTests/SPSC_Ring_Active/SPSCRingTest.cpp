@@ -0,0 +1,94 @@
+/**
+ * @file        SPSCRingTest.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Func test for the lock-free single producer single consumer
+ * ring.
+ * @version     0.1
+ * @date        2021-07-25
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "SPSCRing.hpp"
+#include "Thread.hpp"
+#include <iostream>
+
+constexpr uint32_t RING_DATA_SIGNAL = 0x01U;
+constexpr uint32_t ITEMS_TO_SEND = 100U;
+using sample_ring = RTOS::SPSCRing<uint32_t, 16>;
+
+class ConsumerThread : public RTOS::Thread {
+public:
+  explicit ConsumerThread(sample_ring &r_ring)
+      : m_rRing(r_ring), Thread("Consumer", 2, 400) {}
+
+private:
+  [[noreturn]] void run() override {
+    uint32_t expected = 0U;
+    uint32_t wake_ups = 0U;
+    for (;;) {
+      // Blocks only till the ring goes from empty to non-empty.
+      (void)wait_for_signal_on_bits(RING_DATA_SIGNAL);
+      ++wake_ups;
+
+      // Drain the ring before waiting again.
+      uint32_t sample = 0U;
+      while (m_rRing.pop(sample)) {
+        if (sample != expected) {
+          std::cout << "Out of order sample: " << sample << std::endl;
+        }
+        ++expected;
+      }
+
+      if (expected == ITEMS_TO_SEND) {
+        std::cout << "Received all samples with " << wake_ups << " wake ups."
+                  << std::endl;
+        std::cout << "Ending the test.";
+        end_scheduler();
+      }
+    }
+  }
+
+  sample_ring &m_rRing;
+};
+
+class ProducerThread : public RTOS::Thread {
+public:
+  ProducerThread(sample_ring &r_ring, RTOS::IThread &r_consumer)
+      : m_rRing(r_ring), m_rConsumer(r_consumer),
+        Thread("Producer", 1, 400) {}
+
+private:
+  [[noreturn]] void run() override {
+    m_rConsumer.join();
+    uint32_t sample = 0U;
+    for (;;) {
+      // Push in bursts so the consumer wakes once per burst.
+      for (uint32_t burst = 0U; (burst < 10U) && (sample < ITEMS_TO_SEND);
+           ++burst) {
+        if (m_rRing.push(sample)) {
+          ++sample;
+        }
+      }
+      delay_ms(10);
+    }
+  }
+
+  sample_ring &m_rRing;
+  RTOS::IThread &m_rConsumer;
+};
+
+int main() {
+  static sample_ring ring;
+  ConsumerThread consumer(ring);
+  ring.attach_consumer(&consumer, RING_DATA_SIGNAL);
+  ProducerThread producer(ring, consumer);
+  producer.join();
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
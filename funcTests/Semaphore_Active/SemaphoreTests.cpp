@@ -0,0 +1,119 @@
+/**
+ * @file        SemaphoreTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the counting and the binary semaphores between threads.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <Semaphore.hpp>
+#include <Thread.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr RTOS::semaphore_count_t SLOT_COUNT = 3U;
+
+// APP Section:
+class producer_thread : public RTOS::Thread {
+
+  void run() override {
+    /* Gives more than the maximum, the extra gives fail. */
+    for (uint32_t index = 0U; index < SLOT_COUNT + 1U; ++index) {
+      std::cout << "Release " << index << ": " << m_rSlots.release()
+                << std::endl;
+    }
+    m_rDone.release();
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  producer_thread(RTOS::Semaphore &rSlots, RTOS::Semaphore &rDone)
+      : Thread("Producer", 2, configMINIMAL_STACK_SIZE), m_rSlots(rSlots),
+        m_rDone(rDone) {}
+
+private:
+  RTOS::Semaphore &m_rSlots;
+  RTOS::Semaphore &m_rDone;
+};
+
+class consumer_thread : public RTOS::Thread {
+
+  void run() override {
+    /* Blocks until the producer is done. */
+    (void)m_rDone.acquire();
+    std::cout << "Count: " << m_rSlots.get_count() << std::endl;
+
+    uint32_t taken = 0U;
+    while (m_rSlots.try_acquire_for(50ms)) {
+      ++taken;
+    }
+    std::cout << "Taken: " << taken << std::endl;
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  consumer_thread(RTOS::Semaphore &rSlots, RTOS::Semaphore &rDone)
+      : Thread("Consumer", 3, configMINIMAL_STACK_SIZE), m_rSlots(rSlots),
+        m_rDone(rDone) {}
+
+private:
+  RTOS::Semaphore &m_rSlots;
+  RTOS::Semaphore &m_rDone;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rConsumer.join();
+    m_rProducer.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rProducer, Thread &rConsumer)
+      : Thread("MainThread", 4, configMINIMAL_STACK_SIZE),
+        m_rProducer(rProducer), m_rConsumer(rConsumer) {}
+
+private:
+  Thread &m_rProducer;
+  Thread &m_rConsumer;
+};
+
+int main() {
+  RTOS::CountingSemaphore slots(SLOT_COUNT);
+  RTOS::BinarySemaphore done;
+  producer_thread producer(slots, done);
+  consumer_thread consumer(slots, done);
+  main_thread main_th(producer, consumer);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
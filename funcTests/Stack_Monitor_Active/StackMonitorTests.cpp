@@ -0,0 +1,93 @@
+/**
+ * @file        StackMonitorTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the stack monitor over the registered threads.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <StackMonitor.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr RTOS::stack_size_t TEST_STACK_DEPTH = configMINIMAL_STACK_SIZE * 2;
+
+/* Uses roughly depth * 64 words of stack. */
+uint32_t use_stack(uint32_t const depth) {
+  volatile uint32_t frame[64] = {};
+  frame[depth % 64U] = depth;
+  return (depth == 0U) ? frame[0] : frame[depth % 64U] + use_stack(depth - 1U);
+}
+
+// APP Section:
+class greedy_thread : public RTOS::Thread {
+
+  void run() override {
+    for (uint32_t depth = 1U;; ++depth) {
+      (void)use_stack(depth);
+      delay_ms(50);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  greedy_thread() : Thread("Greedy", 2, TEST_STACK_DEPTH) {}
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rGreedy.join();
+    m_rMonitor.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rGreedy, Thread &rMonitor)
+      : Thread("MainThread", 3, TEST_STACK_DEPTH), m_rGreedy(rGreedy),
+        m_rMonitor(rMonitor) {}
+
+private:
+  Thread &m_rGreedy;
+  Thread &m_rMonitor;
+};
+
+void on_low_stack(RTOS::Thread &rThread, RTOS::stack_size_t const headroom,
+                  void *const pContext) {
+  (void)pContext;
+  std::cout << rThread.get_name() << " has only " << headroom << " of "
+            << rThread.get_stack_size() << " words left" << std::endl;
+
+  std::cout << "Ending the test.";
+  RTOS::Thread::end_scheduler();
+}
+
+int main() {
+  greedy_thread greedy;
+  RTOS::StackMonitor monitor(20ms, TEST_STACK_DEPTH / 4U, on_low_stack);
+  main_thread main_th(greedy, monitor);
+
+  std::cout << "Registered threads: "
+            << RTOS::ThreadRegistry::get_Instance().count() << std::endl;
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file        StaticThreadTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the threads with compile time sized storage.
+ * @version     0.1
+ * @date        2021-07-24
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <StaticThread.hpp>
+
+constexpr RTOS::stack_size_t TEST_STACK_DEPTH = configMINIMAL_STACK_SIZE * 2;
+
+// APP Section:
+class test_thr : public RTOS::StaticThread<TEST_STACK_DEPTH> {
+
+  int value_of_thread;
+  void run() override {
+    for (;;) {
+      std::cout << "running static thread number" << value_of_thread
+                << std::endl;
+      Thread::delay_ms(500);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit test_thr(int thread_number)
+      : value_of_thread(thread_number), StaticThread("StaticThr", 1) {}
+};
+
+class main_thread : public RTOS::StaticThread<TEST_STACK_DEPTH> {
+
+  void run() override {
+    std::cout << "Adding Main Thread" << std::endl;
+    m_rThreadOne.join();
+    m_rThreadTwo.join();
+    delay_ms(500);
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &threadOne, Thread &threadTwo)
+      : m_rThreadOne(threadOne), m_rThreadTwo(threadTwo),
+        StaticThread("MainThread", 2) {}
+
+private:
+  Thread &m_rThreadOne;
+  Thread &m_rThreadTwo;
+};
+
+// Threads are kept in static storage to have them in the linker map.
+static test_thr thread_one(1);
+static test_thr thread_two(2);
+static main_thread main_th(thread_one, thread_two);
+
+int main() {
+  /* None of the threads above should have used the RTOS heap. */
+  std::cout << "Free heap before join: " << xPortGetFreeHeapSize()
+            << std::endl;
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
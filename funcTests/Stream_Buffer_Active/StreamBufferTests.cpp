@@ -0,0 +1,155 @@
+/**
+ * @file        StreamBufferTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the stream and the message buffers between two threads.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// RTOS
+#include <StreamBuffer.hpp>
+#include <Thread.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr size_t TRIGGER_LEVEL = 8U;
+
+using stream_t = RTOS::StreamBuffer<32>;
+/* Holds exactly one trigger level, the reader wakes only once it is full. */
+using full_stream_t = RTOS::StreamBuffer<TRIGGER_LEVEL>;
+using messages_t = RTOS::MessageBuffer<64>;
+
+// APP Section:
+class writer_thread : public RTOS::Thread {
+
+  void run() override {
+    /* Byte by byte like a UART ISR, the reader wakes once per trigger level. */
+    char const *const pText = "0123456789abcdef";
+    for (size_t index = 0U; index < std::strlen(pText); ++index) {
+      (void)m_rStream.send(&pText[index], 1U);
+      delay_ms(1);
+    }
+
+    char const *const pFill = "ABCDEFGH";
+    for (size_t index = 0U; index < TRIGGER_LEVEL; ++index) {
+      (void)m_rFullStream.send(&pFill[index], 1U);
+      delay_ms(1);
+    }
+
+    char const *const pRecords[] = {"boot", "sensor ok", "radio ok"};
+    for (char const *const pRecord : pRecords) {
+      (void)m_rMessages.send(pRecord, std::strlen(pRecord));
+    }
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  writer_thread(stream_t &rStream, full_stream_t &rFullStream,
+                messages_t &rMessages)
+      : Thread("Writer", 2, configMINIMAL_STACK_SIZE), m_rStream(rStream),
+        m_rFullStream(rFullStream), m_rMessages(rMessages) {}
+
+private:
+  stream_t &m_rStream;
+  full_stream_t &m_rFullStream;
+  messages_t &m_rMessages;
+};
+
+class reader_thread : public RTOS::Thread {
+
+  void run() override {
+    uint8_t bytes[TRIGGER_LEVEL];
+    for (uint32_t burst = 0U; burst < 2U; ++burst) {
+      RTOS::byte_span_s const read =
+          m_rStream.receive(RTOS::byte_span_s{bytes, sizeof(bytes)}, 1s);
+      std::cout << "Burst: "
+                << std::string(reinterpret_cast<char *>(read.pData),
+                               read.size)
+                << std::endl;
+    }
+
+    /* The trigger level is the whole buffer, reached by the last byte. */
+    RTOS::byte_span_s const full =
+        m_rFullStream.receive(RTOS::byte_span_s{bytes, sizeof(bytes)}, 1s);
+    std::cout << "Full: "
+              << std::string(reinterpret_cast<char *>(full.pData), full.size)
+              << std::endl;
+
+    char record[16];
+    size_t size = 0U;
+    while ((size = m_rMessages.receive(record, sizeof(record), 100ms)) > 0U) {
+      std::cout << "Record: " << std::string(record, size) << std::endl;
+    }
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  reader_thread(stream_t &rStream, full_stream_t &rFullStream,
+                messages_t &rMessages)
+      : Thread("Reader", 3, configMINIMAL_STACK_SIZE), m_rStream(rStream),
+        m_rFullStream(rFullStream), m_rMessages(rMessages) {}
+
+private:
+  stream_t &m_rStream;
+  full_stream_t &m_rFullStream;
+  messages_t &m_rMessages;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    m_rReader.join();
+    m_rWriter.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rWriter, Thread &rReader)
+      : Thread("MainThread", 4, configMINIMAL_STACK_SIZE), m_rWriter(rWriter),
+        m_rReader(rReader) {}
+
+private:
+  Thread &m_rWriter;
+  Thread &m_rReader;
+};
+
+int main() {
+  static stream_t stream(TRIGGER_LEVEL);
+  static full_stream_t full_stream(TRIGGER_LEVEL);
+  static messages_t messages;
+  writer_thread writer(stream, full_stream, messages);
+  reader_thread reader(stream, full_stream, messages);
+  main_thread main_th(writer, reader);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -17,7 +17,7 @@
 #include "Time64.hpp"
 
 // APP Section:
-class clock : public RTOS::Thread {
+class system_clock : public RTOS::Thread {
 
   RTOS::ITime64 const &m_rTime64;
 
@@ -38,14 +38,14 @@ class clock : public RTOS::Thread {
   }
 
 public:
-  explicit clock(const RTOS::ITime64 &mRTime64)
+  explicit system_clock(const RTOS::ITime64 &mRTime64)
       : Thread("SndThr", 1, 100), m_rTime64(mRTime64) {}
 };
 
 int main() {
   RTOS::Time64 rtosTime;
 
-  clock clockObject(rtosTime);
+  system_clock clockObject(rtosTime);
   clockObject.join();
   return 0;
 }
@@ -0,0 +1,97 @@
+/**
+ * @file        TimerTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the auto reload and the one shot timers.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// RTOS
+#include <Thread.hpp>
+#include <Timer.hpp>
+
+using namespace std::chrono_literals;
+
+// APP Section:
+void on_heartbeat(RTOS::Timer &rTimer, void *const pContext) {
+  (void)rTimer;
+  ++(*static_cast<uint32_t *>(pContext));
+}
+
+/* One shot timer that stops the heartbeat and ends the test. */
+class end_of_test_timer : public RTOS::Timer {
+
+  void on_expiry() override {
+    (void)m_rHeartbeat.stop();
+    std::cout << "Heartbeats: " << m_rBeats << std::endl;
+    std::cout << "Ending the test.";
+    RTOS::Thread::end_scheduler();
+  }
+
+public:
+  end_of_test_timer(RTOS::Timer &rHeartbeat, uint32_t &rBeats)
+      : Timer("EndOfTest", 1s, RTOS::timer_mode_e::eOneShot),
+        m_rHeartbeat(rHeartbeat), m_rBeats(rBeats) {}
+
+  /* The expiry is overridden, so the timer is released before the members. */
+  ~end_of_test_timer() override { release(); }
+
+private:
+  RTOS::Timer &m_rHeartbeat;
+  uint32_t &m_rBeats;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    (void)m_rHeartbeat.start();
+    (void)m_rEndOfTest.start();
+
+    /* Halves the period half way through. */
+    delay_ms(500);
+    (void)m_rHeartbeat.change_period(50ms);
+    std::cout << "Heartbeat period: " << m_rHeartbeat.get_period().ticks()
+              << std::endl;
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(RTOS::Timer &rHeartbeat, RTOS::Timer &rEndOfTest)
+      : Thread("MainThread", 2, configMINIMAL_STACK_SIZE),
+        m_rHeartbeat(rHeartbeat), m_rEndOfTest(rEndOfTest) {}
+
+private:
+  RTOS::Timer &m_rHeartbeat;
+  RTOS::Timer &m_rEndOfTest;
+};
+
+int main() {
+  /* Only the daemon touches the count, both expiries run in it. */
+  static uint32_t beats = 0U;
+  static RTOS::Timer heartbeat("Heartbeat", 100ms,
+                               RTOS::timer_mode_e::eAutoReload, on_heartbeat,
+                               &beats);
+  static end_of_test_timer end_of_test(heartbeat, beats);
+  main_thread main_th(heartbeat, end_of_test);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file        TraceTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Records application markers, events and values for SystemView.
+ * @version     0.1
+ * @date        2021-08-01
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <atomic>
+#include <iostream>
+
+// RTOS
+#include <TQueue.hpp>
+#include <Thread.hpp>
+#include <Trace.hpp>
+
+constexpr RTOS::Trace::marker_id_t PRODUCE_MARKER = 1U;
+
+/* Events of the application module. */
+constexpr RTOS::Trace::event_id_t EVT_PRODUCED = 0U;
+constexpr RTOS::Trace::event_id_t EVT_CONSUMED = 1U;
+
+static RTOS::Trace::Module g_appModule(
+    "M=TraceTest, 0 Produced item=%u, 1 Consumed item=%u", 2U);
+static RTOS::Trace::ValuePlot g_queueDepth("M=QueueDepth, 0 depth=%u");
+static std::atomic<uint32_t> g_depth(0U);
+
+using item_queue_t = RTOS::TQueue<uint32_t, 8>;
+
+// APP Section:
+class producer_thread : public RTOS::Thread {
+
+  void run() override {
+    for (uint32_t item = 0U; item < 32U; ++item) {
+      {
+        RTOS::Trace::ScopedMarker const marker(PRODUCE_MARKER);
+        m_rQueue.enqueue(item);
+        g_appModule.record(EVT_PRODUCED, item);
+      }
+      g_queueDepth.sample(++g_depth);
+      delay_ms(1);
+    }
+    while (true) {
+      delay_ms(1000);
+    }
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit producer_thread(item_queue_t &rQueue)
+      : Thread("Producer", 2, configMINIMAL_STACK_SIZE), m_rQueue(rQueue) {}
+
+private:
+  item_queue_t &m_rQueue;
+};
+
+class consumer_thread : public RTOS::Thread {
+
+  void run() override {
+    uint32_t item = 0U;
+    for (uint32_t count = 0U; count < 32U; ++count) {
+      m_rQueue.dequeue(item);
+      g_appModule.record(EVT_CONSUMED, item);
+      g_queueDepth.sample(--g_depth);
+      delay_ms(2);
+    }
+    RTOS::Trace::print("Trace test done");
+    std::cout << "Tracing enabled: " << RTOS::Trace::IS_ENABLED << std::endl;
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit consumer_thread(item_queue_t &rQueue)
+      : Thread("Consumer", 2, configMINIMAL_STACK_SIZE), m_rQueue(rQueue) {}
+
+private:
+  item_queue_t &m_rQueue;
+};
+
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    /* SystemView is configured when the scheduler starts. */
+    g_appModule.register_module();
+    g_queueDepth.register_plot();
+    RTOS::Trace::name_marker(PRODUCE_MARKER, "Produce");
+
+    m_rProducer.join();
+    m_rConsumer.join();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  main_thread(Thread &rProducer, Thread &rConsumer)
+      : Thread("MainThread", 3, configMINIMAL_STACK_SIZE),
+        m_rProducer(rProducer), m_rConsumer(rConsumer) {}
+
+private:
+  Thread &m_rProducer;
+  Thread &m_rConsumer;
+};
+
+int main() {
+  item_queue_t queue;
+  producer_thread producer(queue);
+  consumer_thread consumer(queue);
+  main_thread main_th(producer, consumer);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file        WorkQueueTests.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests the work queue running jobs by priority on shared
+ * workers.
+ * @version     0.1
+ * @date        2021-08-03
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+// IO
+#include <iostream>
+
+// Std
+#include <atomic>
+
+// RTOS
+#include <Semaphore.hpp>
+#include <Thread.hpp>
+#include <WorkQueue.hpp>
+
+constexpr size_t JOB_DEPTH = 4U;
+constexpr uint32_t SUM_JOBS = 8U;
+
+// Queues are kept in static storage to have the worker stacks in the linker
+// map.
+// A single worker shows the order of the priorities.
+static RTOS::WorkQueue<1U, JOB_DEPTH> ordered_queue("Order", 2);
+// Two workers share the jobs of the sum.
+static RTOS::WorkQueue<2U, JOB_DEPTH> pool("Pool", 2);
+
+static std::atomic<uint32_t> sum(0U);
+
+void print_job(char const *const pText) { std::cout << pText << std::endl; }
+
+// APP Section:
+class main_thread : public RTOS::Thread {
+
+  void run() override {
+    /* Queued before the worker runs, so the worker finds all of them. */
+    (void)ordered_queue.submit([] { print_job("Low job"); },
+                               RTOS::job_priority_e::eLow);
+    (void)ordered_queue.submit([] { print_job("Normal job"); });
+    (void)ordered_queue.submit([] { print_job("High job"); },
+                               RTOS::job_priority_e::eHigh);
+
+    /* The normal queue has room for 3 more, the last one is refused. */
+    for (uint32_t index = 0U; index < JOB_DEPTH; ++index) {
+      (void)ordered_queue.submit([] {});
+    }
+    std::cout << "Pending: " << ordered_queue.get_pending() << std::endl;
+    std::cout << "Rejected: " << ordered_queue.get_rejected() << std::endl;
+
+    RTOS::Semaphore *const pDone = &m_rDone;
+    (void)ordered_queue.submit([pDone] { (void)pDone->release(); },
+                               RTOS::job_priority_e::eLow);
+    ordered_queue.start();
+    (void)m_rDone.acquire();
+    std::cout << "Completed: " << ordered_queue.get_completed() << std::endl;
+
+    /* Jobs capture their values, the workers share them. */
+    pool.start();
+    std::cout << "Workers: " << pool.get_worker(0U).get_name() << " "
+              << pool.get_worker(1U).get_name() << std::endl;
+    for (uint32_t value = 1U; value <= SUM_JOBS; ++value) {
+      (void)pool.submit(
+          [value, pDone] {
+            (void)sum.fetch_add(value);
+            (void)pDone->release();
+          },
+          RTOS::job_priority_e::eNormal, RTOS::wait_forever);
+    }
+    for (uint32_t index = 0U; index < SUM_JOBS; ++index) {
+      (void)m_rDone.acquire();
+    }
+    std::cout << "Sum: " << sum.load() << std::endl;
+
+    std::cout << "Ending the test.";
+    end_scheduler();
+  }
+
+  RTOS::return_status_e thread_delete() override {
+    return RTOS::return_status_e::eRTOSSuccess;
+  }
+
+public:
+  explicit main_thread(RTOS::Semaphore &rDone)
+      : Thread("MainThread", 4, configMINIMAL_STACK_SIZE), m_rDone(rDone) {}
+
+private:
+  RTOS::Semaphore &m_rDone;
+};
+
+int main() {
+  RTOS::CountingSemaphore done(SUM_JOBS);
+  main_thread main_th(done);
+
+  main_th.join();
+  return 0;
+}
+
+void vAssertCalled(unsigned long ulLine, const char *const pcFileName) {
+  printf("ASSERT: %s : %d\n", pcFileName, (int)ulLine);
+  while (1)
+    ;
+}
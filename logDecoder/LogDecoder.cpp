@@ -0,0 +1,277 @@
+/**
+ * @file        LogDecoder.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Host side decoder that formats the records of the binary logger
+ * as text lines.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+// Std
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// RTOS
+#include <BinaryLogFormat.hpp>
+
+using RTOS::LogFormat::record_e;
+
+/**
+ * @brief   Raw argument of a line as recorded.
+ */
+struct arg_s {
+  uint64_t bits; /**< Value, zero extended if narrow. */
+  bool isWide;   /**< Recorded with 8 bytes.          */
+};
+
+/**
+ * @brief   Reads the records from the start of the byte stream.
+ */
+class record_reader {
+public:
+  explicit record_reader(std::vector<uint8_t> const &rBytes)
+      : m_rBytes(rBytes), m_offset(0U) {}
+
+  bool has(size_t const count) const {
+    return (m_offset + count) <= m_rBytes.size();
+  }
+
+  uint8_t u8() { return m_rBytes[m_offset++]; }
+
+  uint32_t u32() {
+    uint32_t value = 0U;
+    std::memcpy(&value, &m_rBytes[m_offset], sizeof(value));
+    m_offset += sizeof(value);
+    return value;
+  }
+
+  uint64_t u64() {
+    uint64_t value = 0U;
+    std::memcpy(&value, &m_rBytes[m_offset], sizeof(value));
+    m_offset += sizeof(value);
+    return value;
+  }
+
+  std::string text(size_t const length) {
+    std::string value(reinterpret_cast<char const *>(&m_rBytes[m_offset]),
+                      length);
+    m_offset += length;
+    return value;
+  }
+
+  size_t offset() const { return m_offset; }
+
+private:
+  std::vector<uint8_t> const &m_rBytes;
+  size_t m_offset;
+};
+
+/**
+ * @brief   Formats the arguments like printf. The length modifiers of the
+ * format are replaced by the width the argument was recorded with.
+ */
+std::string format_line(std::string const &rFormat,
+                        std::vector<arg_s> const &rArgs) {
+  std::string line;
+  size_t argIndex = 0U;
+  char buffer[128];
+
+  for (size_t index = 0U; index < rFormat.size(); ++index) {
+    if (rFormat[index] != '%') {
+      line += rFormat[index];
+      continue;
+    }
+    if ((index + 1U < rFormat.size()) && (rFormat[index + 1U] == '%')) {
+      line += '%';
+      ++index;
+      continue;
+    }
+
+    /* Flags, width and precision are kept, the length is dropped. */
+    std::string spec = "%";
+    size_t cursor = index + 1U;
+    while ((cursor < rFormat.size()) &&
+           (std::strchr("-+ #0123456789.", rFormat[cursor]) != nullptr)) {
+      spec += rFormat[cursor++];
+    }
+    while ((cursor < rFormat.size()) &&
+           (std::strchr("hljztL", rFormat[cursor]) != nullptr)) {
+      ++cursor;
+    }
+    if (cursor >= rFormat.size()) {
+      line += rFormat.substr(index);
+      break;
+    }
+    char const conversion = rFormat[cursor];
+    index = cursor;
+
+    if (argIndex >= rArgs.size()) {
+      line += "<?>";
+      continue;
+    }
+    arg_s const arg = rArgs[argIndex++];
+
+    switch (conversion) {
+    case 'd':
+    case 'i':
+      if (arg.isWide) {
+        std::snprintf(buffer, sizeof(buffer), (spec + "lld").c_str(),
+                      static_cast<long long>(arg.bits));
+      } else {
+        std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+                      static_cast<int>(static_cast<int32_t>(arg.bits)));
+      }
+      break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+      if (arg.isWide) {
+        std::snprintf(buffer, sizeof(buffer),
+                      (spec + "ll" + conversion).c_str(),
+                      static_cast<unsigned long long>(arg.bits));
+      } else {
+        std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+                      static_cast<unsigned>(arg.bits));
+      }
+      break;
+    case 'c':
+      std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+                    static_cast<int>(arg.bits));
+      break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A': {
+      double value = 0.0;
+      if (arg.isWide) {
+        std::memcpy(&value, &arg.bits, sizeof(value));
+      } else {
+        value = static_cast<double>(static_cast<int32_t>(arg.bits));
+      }
+      std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+                    value);
+      break;
+    }
+    case 'p':
+      std::snprintf(buffer, sizeof(buffer), "0x%llx",
+                    static_cast<unsigned long long>(arg.bits));
+      break;
+    default:
+      /* Strings are never recorded. */
+      std::snprintf(buffer, sizeof(buffer), "<%%%c>", conversion);
+      break;
+    }
+    line += buffer;
+  }
+  return line;
+}
+
+/**
+ * @brief   Prints every record of the log.
+ * @return  int 0 if the whole log was decoded, 1 if it ends in the middle of a
+ * record or has an unknown record.
+ */
+int decode(std::vector<uint8_t> const &rBytes) {
+  std::map<uint32_t, std::string> formats;
+  record_reader reader(rBytes);
+  double frequency = 0.0;
+
+  while (reader.has(1U)) {
+    size_t const start = reader.offset();
+    record_e const type = static_cast<record_e>(reader.u8());
+
+    if ((type == record_e::eStart) &&
+        reader.has(RTOS::LogFormat::START_SIZE - 1U)) {
+      uint8_t const version = reader.u8();
+      frequency = static_cast<double>(reader.u32());
+      if (version != RTOS::LogFormat::VERSION) {
+        std::fprintf(stderr, "Log version %u, the decoder reads version %u\n",
+                     version, RTOS::LogFormat::VERSION);
+      }
+
+    } else if ((type == record_e::eFormat) &&
+               reader.has(RTOS::LogFormat::FORMAT_HEADER_SIZE - 1U)) {
+      uint8_t const length = reader.u8();
+      uint32_t const id = reader.u32();
+      if (!reader.has(length)) {
+        std::fprintf(stderr, "Log ends in a format at %zu\n", start);
+        return 1;
+      }
+      formats[id] = reader.text(length);
+
+    } else if ((type == record_e::eLine) &&
+               reader.has(RTOS::LogFormat::LINE_HEADER_SIZE - 1U)) {
+      uint8_t const count = reader.u8();
+      uint8_t const wideMask = reader.u8();
+      uint32_t const id = reader.u32();
+      uint32_t const timestamp = reader.u32();
+
+      std::vector<arg_s> args;
+      for (uint8_t index = 0U; index < count; ++index) {
+        bool const isWide = ((wideMask >> index) & 0x01U) != 0U;
+        if (!reader.has(isWide ? RTOS::LogFormat::WIDE_ARG_SIZE
+                               : RTOS::LogFormat::NARROW_ARG_SIZE)) {
+          std::fprintf(stderr, "Log ends in a line at %zu\n", start);
+          return 1;
+        }
+        args.push_back({isWide ? reader.u64() : reader.u32(), isWide});
+      }
+
+      auto const format = formats.find(id);
+      std::string const text =
+          (format != formats.end())
+              ? format_line(format->second, args)
+              : ("<format " + std::to_string(id) + " not in the log>");
+      if (frequency > 0.0) {
+        std::printf("[%12.6f] %s\n", timestamp / frequency, text.c_str());
+      } else {
+        std::printf("[%12u] %s\n", timestamp, text.c_str());
+      }
+
+    } else if ((type == record_e::eDropped) &&
+               reader.has(RTOS::LogFormat::DROPPED_SIZE - 1U)) {
+      std::printf("<%u lines dropped>\n", reader.u32());
+
+    } else {
+      std::fprintf(stderr, "Unknown or cut record at %zu\n", start);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief   Decodes the log file given, or the standard input.
+ */
+int main(int argc, char **argv) {
+  FILE *pFile = stdin;
+  if (argc > 1) {
+    pFile = std::fopen(argv[1], "rb");
+    if (pFile == nullptr) {
+      std::fprintf(stderr, "Could not open %s\n", argv[1]);
+      return 1;
+    }
+  }
+
+  std::vector<uint8_t> bytes;
+  uint8_t chunk[4096];
+  size_t length = 0U;
+  while ((length = std::fread(chunk, 1U, sizeof(chunk), pFile)) > 0U) {
+    bytes.insert(bytes.end(), chunk, chunk + length);
+  }
+  if (pFile != stdin) {
+    (void)std::fclose(pFile);
+  }
+  return decode(bytes);
+}
@@ -11,7 +11,15 @@
 
 #include <stdio.h>
 
+#if (SYSTEM_VIEW_ANALYSIS == 1) && defined(SIM)
+#include "sysviewPostMortem.h"
+#endif
+
 void RTOS_ASSERT(char const* file, unsigned int const line){
-  printf("RTOS ASSERT: %s : %d\n", file, (int)line);                        \
+  printf("RTOS ASSERT: %s : %d\n", file, (int)line);
+#if (SYSTEM_VIEW_ANALYSIS == 1) && defined(SIM)
+  /* The recording up to the assert is kept for the analysis. */
+  vSysViewDumpTrace();
+#endif
   while (1);
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * @file      runTimeStats.c
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Run time counter of each port and the context switch counting
+ * used by the kernel run time statistics.
+ * @version   0.1
+ * @date      28-07-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if configGENERATE_RUN_TIME_STATS == 1
+
+#if defined(SIM) && defined(POSIX_SIM)
+/*----------------- POSIX simulator: monotonic clock of the host -------------*/
+#include <time.h>
+
+static uint64_t ullStartTimeNs = 0U;
+
+static uint64_t prvGetTimeNs(void) {
+  struct timespec xNow;
+  (void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+  return ((uint64_t)xNow.tv_sec * 1000000000ULL) + (uint64_t)xNow.tv_nsec;
+}
+
+void vConfigureRunTimeCounter(void) { ullStartTimeNs = prvGetTimeNs(); }
+
+uint32_t ulGetRunTimeCounterValue(void) {
+  return (uint32_t)(((prvGetTimeNs() - ullStartTimeNs) *
+                     configRUN_TIME_COUNTER_HZ) /
+                    1000000000ULL);
+}
+
+#elif defined(SIM)
+/*----------------- Windows simulator: performance counter -------------------*/
+#include <windows.h>
+
+static LARGE_INTEGER xStartCount;
+static LARGE_INTEGER xCountsPerSecond;
+
+void vConfigureRunTimeCounter(void) {
+  (void)QueryPerformanceFrequency(&xCountsPerSecond);
+  (void)QueryPerformanceCounter(&xStartCount);
+}
+
+uint32_t ulGetRunTimeCounterValue(void) {
+  LARGE_INTEGER xNow;
+  (void)QueryPerformanceCounter(&xNow);
+  return (uint32_t)(((uint64_t)(xNow.QuadPart - xStartCount.QuadPart) *
+                     configRUN_TIME_COUNTER_HZ) /
+                    (uint64_t)xCountsPerSecond.QuadPart);
+}
+
+#else
+/*----------------- Cortex-M: DWT cycle counter ------------------------------*/
+#define rtsDEMCR (*(volatile uint32_t *)0xE000EDFCUL)
+#define rtsDEMCR_TRCENA (1UL << 24)
+#define rtsDWT_CTRL (*(volatile uint32_t *)0xE0001000UL)
+#define rtsDWT_CTRL_CYCCNTENA (1UL << 0)
+#define rtsDWT_CYCCNT (*(volatile uint32_t *)0xE0001004UL)
+
+/* CPU cycles in a single count of the run time counter. */
+#define rtsCYCLES_PER_COUNT (configCPU_CLOCK_HZ / configRUN_TIME_COUNTER_HZ)
+
+/* Ticks between two reads of the counter made from the tick interrupt. */
+#define rtsSAMPLE_TICKS (configTICK_RATE_HZ)
+
+/* The cycle counter wraps every 2^32 cycles (~60 s at 72 MHz), so it is
+folded into a slower counter every time it is read. A wrap is lost if two
+reads are further apart than that. Reads are made on every context switch,
+which stops when a single task keeps running, so the tick interrupt also
+reads it once every rtsSAMPLE_TICKS. */
+static uint32_t ulLastCycles = 0U;
+static uint32_t ulPendingCycles = 0U;
+static uint32_t ulCounter = 0U;
+
+void vConfigureRunTimeCounter(void) {
+  rtsDEMCR |= rtsDEMCR_TRCENA;
+  rtsDWT_CYCCNT = 0U;
+  rtsDWT_CTRL |= rtsDWT_CTRL_CYCCNTENA;
+  ulLastCycles = 0U;
+  ulPendingCycles = 0U;
+  ulCounter = 0U;
+}
+
+uint32_t ulGetRunTimeCounterValue(void) {
+  /* Called from the context switch as well as from the tasks. */
+  UBaseType_t const uxSavedMask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+  uint32_t const ulNow = rtsDWT_CYCCNT;
+  uint32_t const ulElapsed = ulNow - ulLastCycles;
+  ulLastCycles = ulNow;
+
+  /* 32 bit divisions only, the M3 has no 64 bit divide. */
+  ulCounter += ulElapsed / rtsCYCLES_PER_COUNT;
+  ulPendingCycles += ulElapsed % rtsCYCLES_PER_COUNT;
+  if (ulPendingCycles >= rtsCYCLES_PER_COUNT) {
+    ulPendingCycles -= rtsCYCLES_PER_COUNT;
+    ++ulCounter;
+  }
+  uint32_t const ulValue = ulCounter;
+
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedMask);
+  return ulValue;
+}
+
+void vRunTimeTickSample(uint32_t ulTickCount) {
+  /* Called from the tick interrupt. */
+  if ((ulTickCount % rtsSAMPLE_TICKS) == 0U) {
+    (void)ulGetRunTimeCounterValue();
+  }
+}
+#endif
+#endif /* configGENERATE_RUN_TIME_STATS == 1 */
+
+/*----------------- Context switch count of each task ------------------------*/
+void vRunTimeTaskSwitchedIn(void *pxTCB) {
+  /* Only a change of the running task is a switch. */
+  static void *pxLastTCB = NULL;
+
+  if (pxTCB != pxLastTCB) {
+    pxLastTCB = pxTCB;
+    /* The count is kept in the pointer itself, starting from NULL i.e 0. */
+    TaskHandle_t const xTask = (TaskHandle_t)pxTCB;
+    uintptr_t const uxCount = (uintptr_t)pvTaskGetThreadLocalStoragePointer(
+        xTask, configRUN_TIME_SWITCH_COUNT_INDEX);
+    vTaskSetThreadLocalStoragePointer(xTask, configRUN_TIME_SWITCH_COUNT_INDEX,
+                                      (void *)(uxCount + 1U));
+  }
+}
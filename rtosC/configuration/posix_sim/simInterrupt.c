@@ -0,0 +1,16 @@
+/**
+ * @file      simInterrupt.c
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Interrupt context of the POSIX simulator, which has no real
+ * interrupts.
+ * @version   0.1
+ * @date      04-08-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "FreeRTOS.h"
+
+/* Raised by code that simulates an ISR, read by xPortIsInsideInterrupt(). */
+volatile long xSimInsideInterrupt = pdFALSE;
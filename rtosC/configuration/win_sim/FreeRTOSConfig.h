@@ -112,22 +112,26 @@ extern "C" {
 #define configAPPLICATION_ALLOCATED_HEAP 0
 
 /* Software timer related configuration options. */
-#define configUSE_TIMERS 0
+#define configUSE_TIMERS 1
 #define configTIMER_TASK_PRIORITY (configMAX_PRIORITIES - 1)
 #define configTIMER_QUEUE_LENGTH 20
 #define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
 
 #define configMAX_PRIORITIES (7)
 
-///* Run time stats gathering configuration options. */
-// unsigned long ulGetRunTimeCounterValue( void ); /* Prototype of function that
-// returns run time counter. */ #define configGENERATE_RUN_TIME_STATS
-// 1
-///* Make use of times(man 2) to gather run-time statistics on the tasks. */
-// extern void vPortFindTicksPerSecond( void );
-//#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vPortFindTicksPerSecond()
-// extern unsigned long ulPortGetTimerValue( void );
-//#define portGET_RUN_TIME_COUNTER_VALUE() ulPortGetTimerValue()
+/* Run time stats gathering configuration options. The counter is derived
+from QueryPerformanceCounter of the host, see configuration/RunTime_stats. */
+#define configGENERATE_RUN_TIME_STATS 1
+/* Frequency of the run time counter, 10 times the tick rate. */
+#define configRUN_TIME_COUNTER_HZ (configTICK_RATE_HZ * 10UL)
+/* Thread local storage slot counting the context switches of each task. */
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 1
+#define configRUN_TIME_SWITCH_COUNT_INDEX 0
+extern void vConfigureRunTimeCounter(void);
+extern uint32_t ulGetRunTimeCounterValue(void);
+extern void vRunTimeTaskSwitchedIn(void *pxTCB);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vConfigureRunTimeCounter()
+#define portGET_RUN_TIME_COUNTER_VALUE() ulGetRunTimeCounterValue()
 
 /* Co-routine related configuration options. */
 #define configUSE_CO_ROUTINES 0
@@ -151,6 +155,7 @@ functions anyway. */
 #define INCLUDE_vTaskDelay 1
 #define INCLUDE_uxTaskGetStackHighWaterMark 1
 #define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
 #define INCLUDE_xTimerGetTimerDaemonTaskHandle 1
 #define INCLUDE_xTaskGetIdleTaskHandle 1
 #define INCLUDE_pcTaskGetTaskName 1
@@ -162,6 +167,12 @@ functions anyway. */
 #include "SEGGER_SYSVIEW_FreeRTOS.h"
 #endif
 
+/* SystemView owns the switch-in hook when enabled and reports the switches
+itself, the per-task context switch counts stay 0 then. */
+#ifndef traceTASK_SWITCHED_IN
+#define traceTASK_SWITCHED_IN() vRunTimeTaskSwitchedIn(pxCurrentTCB)
+#endif
+
 /* It is a good idea to define configASSERT() while developing.  configASSERT()
 uses the same semantics as the standard C assert() macro. */
 extern void RTOS_ASSERT(char const *file, unsigned int const line);
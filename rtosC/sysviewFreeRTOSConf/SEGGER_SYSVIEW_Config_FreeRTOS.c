@@ -105,6 +105,26 @@ static void _cbSendSystemDesc(void) {
   SEGGER_SYSVIEW_SendSysDesc("I#15=SysTick");
 }
 
+/**
+ * @note: The POSIX simulator counts the timestamp at SYSVIEW_TIMESTAMP_FREQ
+ *        from the monotonic clock of the host.
+ */
+#if defined(SIM) && defined(POSIX_SIM)
+#include <time.h>
+
+uint32_t SEGGER_SYSVIEW_X_GetTimestamp() {
+  struct timespec xNow;
+  (void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+  return (uint32_t)(((uint64_t)xNow.tv_sec * SYSVIEW_TIMESTAMP_FREQ) +
+                    (((uint64_t)xNow.tv_nsec * SYSVIEW_TIMESTAMP_FREQ) /
+                     1000000000ULL));
+}
+
+uint32_t SEGGER_SYSVIEW_X_GetInterruptId() {
+  return 10;
+}
+#endif
+
 /*********************************************************************
 *
 *       Global functions
@@ -115,6 +135,10 @@ void SEGGER_SYSVIEW_Conf(void) {
   SEGGER_SYSVIEW_Init(SYSVIEW_TIMESTAMP_FREQ, SYSVIEW_CPU_FREQ, 
                       &SYSVIEW_X_OS_TraceAPI, _cbSendSystemDesc);
   SEGGER_SYSVIEW_SetRAMBase(SYSVIEW_RAM_BASE);
+#if SEGGER_SYSVIEW_POST_MORTEM_MODE == 1
+  // No host starts a post-mortem recording, it runs from the init.
+  SEGGER_SYSVIEW_Start();
+#endif
 }
 
 /*************************** End of file ****************************/
@@ -0,0 +1,71 @@
+/**
+ * @file      sysviewPostMortem.c
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Saves the post-mortem SystemView recording of the simulator to a
+ * file.
+ * @version   0.1
+ * @date      02-08-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "sysviewPostMortem.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SEGGER_RTT.h"
+#include "SEGGER_SYSVIEW.h"
+
+#ifndef SYSTEM_VIEW_DUMP_FILE
+#define SYSTEM_VIEW_DUMP_FILE "SystemView.SVDat"
+#endif
+
+/* Bytes moved from the up buffer to the file at a time. */
+#define svpmCHUNK_SIZE 256U
+
+void vSysViewDumpTrace(void) {
+  /* The terminal owns channel 0, SystemView gets its own channel on init. */
+  int const lChannel = SEGGER_SYSVIEW_GetChannelID();
+  if (lChannel <= 0) {
+    return;
+  }
+
+  char const *pcPath = getenv("SYSTEM_VIEW_DUMP_FILE");
+  if ((pcPath == NULL) || (pcPath[0] == '\0')) {
+    pcPath = SYSTEM_VIEW_DUMP_FILE;
+  }
+
+  /* Nothing is recorded while the buffer is read, the stop event ends it. */
+  SEGGER_SYSVIEW_Stop();
+
+  FILE *const pxFile = fopen(pcPath, "wb");
+  if (pxFile == NULL) {
+    printf("SYSVIEW: Could not open %s\n", pcPath);
+    return;
+  }
+
+  /* Text header of the SystemView data files, the packets follow it. */
+  (void)fprintf(pxFile,
+                ";\n"
+                "; Version     SEGGER SystemViewer V%d.%02d\n"
+                "; Recorder    FreeRTOS simulator post-mortem dump\n"
+                ";\n",
+                SEGGER_SYSVIEW_MAJOR, SEGGER_SYSVIEW_MINOR);
+
+  /* The ring starts with the oldest byte, which may be in the middle of a
+  packet. SystemView skips to the next sync packet, those are repeated in the
+  post-mortem mode. */
+  unsigned char aucChunk[svpmCHUNK_SIZE];
+  unsigned long ulTotal = 0U;
+  unsigned uRead;
+  do {
+    uRead = SEGGER_RTT_ReadUpBuffer((unsigned)lChannel, aucChunk,
+                                    sizeof(aucChunk));
+    ulTotal += (unsigned long)fwrite(aucChunk, 1U, uRead, pxFile);
+  } while (uRead == sizeof(aucChunk));
+
+  (void)fclose(pxFile);
+  printf("SYSVIEW: %lu bytes of trace written to %s\n", ulTotal, pcPath);
+}
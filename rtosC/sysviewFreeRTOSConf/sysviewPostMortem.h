@@ -0,0 +1,35 @@
+/**
+ * @file      sysviewPostMortem.h
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Saves the post-mortem SystemView recording of the simulator to a
+ * file.
+ * @version   0.1
+ * @date      02-08-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#ifndef SYSVIEW_POST_MORTEM_H
+#define SYSVIEW_POST_MORTEM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stops the recording and writes the SystemView RTT up buffer to a
+ * .SVDat file, which is loaded in SystemView with File -> Load Data.
+ *
+ *          The file is named by the environment variable SYSTEM_VIEW_DUMP_FILE
+ * and otherwise by the build flag of the same name. The buffer is a ring in the
+ * post-mortem mode, so the file holds the latest SYSTEM_VIEW_BUFFER_SIZE bytes
+ * of the recording. Nothing is written if the recording was never initialised.
+ */
+void vSysViewDumpTrace(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYSVIEW_POST_MORTEM_H */
@@ -0,0 +1,240 @@
+/**
+ * @file        BinaryLog.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the logger that sends the log lines unformatted, to
+ * be formatted by the host decoder.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_BINARY_LOG_HPP
+#define RTOS_BINARY_LOG_HPP
+
+#include "BinaryLogFormat.hpp"
+#include "rtos_types.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+/* Bytes of log kept for the reader, see binaryLogConfiguration.cmake */
+#ifndef RTOS_LOG_BUFFER_SIZE
+#define RTOS_LOG_BUFFER_SIZE 4096
+#endif
+
+/* A target with RTT hands the log to the debug probe, else it is kept in a
+ * ring for the application to read. */
+#if (RTT_ENABLED == 1) && !defined(SIM)
+#define RTOS_LOG_USE_RTT 1
+#else
+#define RTOS_LOG_USE_RTT 0
+#endif
+
+/**
+ * @brief   Logs a line of the format and the arguments, for example
+ * RTOS_LOG("rx %u bytes in %u ms", length, time).
+ *
+ *          The format has to be a string literal. Only its id and the raw
+ * arguments are recorded, the host decoder formats the line like printf.
+ */
+#define RTOS_LOG(...)                                                          \
+  do {                                                                         \
+    static RTOS::log_site_s rtosLogSite;                                       \
+    (void)RTOS::BinaryLog::get_Instance().write(rtosLogSite, __VA_ARGS__);     \
+  } while (0)
+
+namespace RTOS {
+
+/**
+ * @brief   State of a single RTOS_LOG call, the format is sent to the host on
+ * the first line logged from it.
+ */
+struct log_site_s {
+  constexpr log_site_s() : id(0U), isDefined(false) {}
+
+  std::atomic<uint32_t> id;     /**< Format id, 0 until the first line.  */
+  std::atomic<bool> isDefined;  /**< The format record is in the log.    */
+};
+
+/**
+ * @brief   Singleton that records the log lines as binary records.
+ *
+ *          A line costs the copy of its arguments and a single write to the
+ * log, it never formats and never blocks. A line that does not fit is dropped
+ * and the number of dropped lines is reported in the log. Any thread or ISR
+ * can log.
+ *
+ *          On a target with RTT the records go to an up buffer of their own
+ * read by the debug probe. Otherwise they go to a lock-free ring that a single
+ * reader drains with read(), to a file on the simulator or to any transport
+ * on a target. The layout of the records is in BinaryLogFormat.hpp.
+ */
+class BinaryLog {
+public:
+  static constexpr size_t BUFFER_SIZE = RTOS_LOG_BUFFER_SIZE;
+
+  static BinaryLog &get_Instance();
+
+  BinaryLog(BinaryLog const &) = delete;
+  BinaryLog &operator=(BinaryLog const &) = delete;
+
+  /**
+   * @brief   Records a line, use RTOS_LOG instead of calling this.
+   *
+   * @param   rSite State of the call, has static storage.
+   * @param   pFormat printf like format, string literal only.
+   * @param   args Numbers, enums or pointers. Strings are not copied.
+   * @return  true if the line is in the log, false if it was dropped.
+   */
+  template <typename... Args>
+  bool write(log_site_s &rSite, char const *const pFormat,
+             Args const... args) {
+    static_assert(sizeof...(Args) <= LogFormat::MAX_ARGS,
+                  "RTOS: A log line takes at most 8 arguments!!");
+
+    uint8_t record[LogFormat::MAX_LINE_SIZE];
+    size_t length = LogFormat::LINE_HEADER_SIZE;
+    uint8_t wideMask = 0U;
+    uint8_t index = 0U;
+    (encode_arg(record, length, wideMask, index++, args), ...);
+    return write_line(rSite, pFormat, record, length,
+                      static_cast<uint8_t>(sizeof...(Args)), wideMask);
+  }
+
+  /**
+   * @brief   Moves whole records out of the ring. Only a single reader calls
+   * this.
+   *
+   * @param   pBuffer Receives the records.
+   * @param   size Size of the buffer, at least LogFormat::MAX_FORMAT_SIZE to
+   * fit any record.
+   * @return  size_t Number of bytes copied, 0 if the ring is empty or the log
+   * goes to RTT.
+   */
+  size_t read(void *pBuffer, size_t size);
+
+  /**
+   * @brief   Number of lines dropped since the start because the log was full.
+   */
+  uint32_t get_dropped() const {
+    return m_droppedTotal.load(std::memory_order_relaxed);
+  }
+
+private:
+#if RTOS_LOG_USE_RTT == 0
+  static constexpr size_t RING_WORDS = BUFFER_SIZE / sizeof(uint32_t);
+  static constexpr uint32_t RING_MASK = RING_WORDS - 1U;
+
+  static_assert((RING_WORDS >= 128U) && ((RING_WORDS & RING_MASK) == 0U),
+                "RTOS: The log buffer size has to be a power of two of at "
+                "least 512 bytes!!");
+#endif
+
+  enum class state_e : uint8_t { eIdle, eStarting, eReady };
+
+  constexpr BinaryLog()
+      : m_state(state_e::eIdle), m_nextId(1U), m_droppedPending(0U),
+        m_droppedTotal(0U),
+#if RTOS_LOG_USE_RTT == 1
+        m_channel(0U), m_buffer()
+#else
+        m_reserved(0U), m_released(0U), m_words()
+#endif
+  {
+  }
+
+  template <typename T>
+  static void put_value(uint8_t *const pRecord, size_t &rLength,
+                        T const value) {
+    std::memcpy(&pRecord[rLength], &value, sizeof(value));
+    rLength += sizeof(value);
+  }
+
+  template <typename T>
+  static void encode_arg(uint8_t *const pRecord, size_t &rLength,
+                         uint8_t &rWideMask, uint8_t const index,
+                         T const value) {
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                      std::is_pointer_v<T>,
+                  "RTOS: Log arguments are numbers, enums or pointers!!");
+    static_assert(!std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>,
+                                  char>,
+                  "RTOS: Strings are not copied to the log, only the format "
+                  "can have text!!");
+
+    if constexpr (std::is_enum_v<T>) {
+      encode_arg(pRecord, rLength, rWideMask, index,
+                 static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      rWideMask |= static_cast<uint8_t>(1U << index);
+      put_value(pRecord, rLength, static_cast<double>(value));
+    } else if constexpr (std::is_pointer_v<T>) {
+      if constexpr (sizeof(uintptr_t) > LogFormat::NARROW_ARG_SIZE) {
+        rWideMask |= static_cast<uint8_t>(1U << index);
+        put_value(pRecord, rLength,
+                  static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+      } else {
+        put_value(pRecord, rLength,
+                  static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value)));
+      }
+    } else if constexpr (sizeof(T) > LogFormat::NARROW_ARG_SIZE) {
+      rWideMask |= static_cast<uint8_t>(1U << index);
+      put_value(pRecord, rLength, static_cast<uint64_t>(value));
+    } else if constexpr (std::is_signed_v<T>) {
+      /* Sign extended so the decoder reads it back as int32_t. */
+      put_value(pRecord, rLength,
+                static_cast<uint32_t>(static_cast<int32_t>(value)));
+    } else {
+      put_value(pRecord, rLength, static_cast<uint32_t>(value));
+    }
+  }
+
+  /**
+   * @brief   Fills the header of the line and writes it, sending the format
+   * first if it is not in the log yet.
+   */
+  bool write_line(log_site_s &rSite, char const *pFormat, uint8_t *pRecord,
+                  size_t length, uint8_t arg_count, uint8_t wide_mask);
+
+  /**
+   * @brief   Sends the start record once, the first caller does it.
+   * @return  false while the log is not started, the line is dropped.
+   */
+  bool is_started();
+
+  bool define_format(log_site_s &rSite, char const *pFormat);
+  void report_dropped();
+  bool drop();
+
+  /**
+   * @brief   Writes the whole record or nothing.
+   */
+  bool put(uint8_t const *pRecord, size_t length);
+
+  static uint32_t get_timestamp();
+  static uint32_t get_timestamp_frequency();
+
+  static BinaryLog m_rBinaryLog;
+
+  std::atomic<state_e> m_state;
+  std::atomic<uint32_t> m_nextId;          /**< Id of the next format.      */
+  std::atomic<uint32_t> m_droppedPending;  /**< Not reported in the log yet. */
+  std::atomic<uint32_t> m_droppedTotal;    /**< Dropped since the start.    */
+#if RTOS_LOG_USE_RTT == 1
+  unsigned m_channel;                      /**< RTT up buffer of the log.   */
+  uint8_t m_buffer[BUFFER_SIZE];           /**< Storage of the up buffer.   */
+#else
+  /* The indices are free running word counts. A record takes a length word
+   * and its bytes rounded up to words. The writer reserves its words first
+   * and stores the length last, so the reader stops at a record that is still
+   * being written. The reader clears the words it took. */
+  std::atomic<uint32_t> m_reserved;        /**< Words taken by writers.     */
+  std::atomic<uint32_t> m_released;        /**< Words given back by reader. */
+  std::atomic<uint32_t> m_words[RING_WORDS]; /**< Ring storage.             */
+#endif
+};
+} // namespace RTOS
+#endif // RTOS_BINARY_LOG_HPP
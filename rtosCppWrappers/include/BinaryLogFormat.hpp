@@ -0,0 +1,61 @@
+/**
+ * @file        BinaryLogFormat.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Layout of the records written by the binary logger, shared with
+ * the host decoder.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_BINARY_LOG_FORMAT_HPP
+#define RTOS_BINARY_LOG_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RTOS {
+
+/**
+ * @brief   The log is a stream of records in the byte order of the target,
+ * little endian on every supported port. Each record starts with its type.
+ *
+ *  eStart   : type, version, u32 timestamp frequency in Hz.
+ *  eFormat  : type, u8 length, u32 format id, length chars of the format.
+ *  eLine    : type, u8 argument count, u8 wide mask, u32 format id,
+ *             u32 timestamp, arguments.
+ *  eDropped : type, u32 number of records dropped since the last report.
+ *
+ *          An argument takes 4 bytes, or 8 bytes if its bit in the wide mask
+ * is set. Integers of up to 32 bits are widened to 4 bytes, 64 bit integers
+ * take 8 bytes, floating point values are sent as 8 byte doubles and pointers
+ * take their own size.
+ */
+namespace LogFormat {
+
+enum class record_e : uint8_t {
+  eStart = 0x01U,
+  eFormat = 0x02U,
+  eLine = 0x03U,
+  eDropped = 0x04U
+};
+
+constexpr uint8_t VERSION = 1U;
+
+constexpr size_t MAX_ARGS = 8U;          /**< Bits of the wide mask.      */
+constexpr size_t MAX_FORMAT_LENGTH = 255U; /**< Longer formats are cut.   */
+constexpr size_t NARROW_ARG_SIZE = 4U;
+constexpr size_t WIDE_ARG_SIZE = 8U;
+
+constexpr size_t START_SIZE = 6U;
+constexpr size_t FORMAT_HEADER_SIZE = 6U;
+constexpr size_t LINE_HEADER_SIZE = 11U;
+constexpr size_t DROPPED_SIZE = 5U;
+
+constexpr size_t MAX_LINE_SIZE = LINE_HEADER_SIZE + (MAX_ARGS * WIDE_ARG_SIZE);
+constexpr size_t MAX_FORMAT_SIZE = FORMAT_HEADER_SIZE + MAX_FORMAT_LENGTH;
+} // namespace LogFormat
+} // namespace RTOS
+#endif // RTOS_BINARY_LOG_FORMAT_HPP
@@ -0,0 +1,172 @@
+/**
+ * @file        BlockPool.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements a fixed block pool handing out owning handles.
+ * @version     0.1
+ * @date        2021-07-26
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_BLOCK_POOL_HPP
+#define RTOS_BLOCK_POOL_HPP
+
+#include "MemoryManager.hpp"
+#include "TQueue.hpp"
+
+#include <new>
+
+namespace RTOS {
+
+/**
+ * @brief       Pool of N blocks of type T.
+ *
+ *              The blocks are allocated once from the MemoryManager and are
+ * constructed in place. The free blocks are held as pointers in a TQueue, so
+ * acquiring and releasing a block is thread and ISR safe and acquire can wait
+ * for a block to be released.
+ *
+ * @tparam T    Type of the block.
+ * @tparam N    Number of blocks in the pool.
+ */
+template <typename T, size_t N> class BlockPool {
+  /* The MemoryManager storage is only aligned to portBYTE_ALIGNMENT. */
+  static_assert(alignof(T) <= portBYTE_ALIGNMENT,
+                "RTOS: Block alignment exceeds the MemoryManager alignment.");
+
+public:
+  /**
+   * @brief   Owning handle to a block of the pool.
+   *
+   *          The handle is move-only and returns the block to the pool when
+   * destroyed. An empty handle owns no block.
+   */
+  class Handle {
+    BlockPool *m_pPool; /**< Pool the block belongs to.                    */
+    T *m_pBlock;        /**< Owned block, nullptr if empty.                 */
+
+    friend class BlockPool;
+    Handle(BlockPool *const pPool, T *const pBlock)
+        : m_pPool(pPool), m_pBlock(pBlock) {}
+
+  public:
+    Handle() : m_pPool(nullptr), m_pBlock(nullptr) {}
+
+    Handle(Handle &&src) noexcept
+        : m_pPool(src.m_pPool), m_pBlock(src.release()) {}
+
+    Handle &operator=(Handle &&src) noexcept {
+      if (this != &src) {
+        reset();
+        m_pPool = src.m_pPool;
+        m_pBlock = src.release();
+      }
+      return *this;
+    }
+
+    Handle(Handle const &) = delete;
+    Handle &operator=(Handle const &) = delete;
+
+    ~Handle() { reset(); }
+
+    /**
+     * @brief   Returns the owned block to the pool. Handle becomes empty.
+     */
+    void reset() {
+      if (m_pBlock != nullptr) {
+        m_pPool->release(m_pBlock);
+        m_pBlock = nullptr;
+      }
+    }
+
+    /**
+     * @brief   Gives up the ownership with out returning the block.
+     *
+     * @return  T* The block, which has to be handed back to the pool by
+     * BlockPool::adopt or BlockPool::release.
+     */
+    T *release() {
+      T *const pBlock = m_pBlock;
+      m_pBlock = nullptr;
+      return pBlock;
+    }
+
+    T *get() const { return m_pBlock; }
+    T &operator*() const { return *m_pBlock; }
+    T *operator->() const { return m_pBlock; }
+    explicit operator bool() const { return m_pBlock != nullptr; }
+  };
+
+  /**
+   * @brief Construct a new pool.
+   */
+  BlockPool() : m_pBlocks(nullptr), m_freeBlocks() {
+    /* Try and successfully get the storage for all the blocks. */
+    bool const isSuccessful =
+        MemoryManager::get_Instance().get_block(
+            (void **)(&m_pBlocks), N * sizeof(T)) == eMemAllocationSuccess;
+
+    if (isSuccessful) {
+      for (size_t index = 0U; index < N; ++index) {
+        T *const pBlock = new (&m_pBlocks[index]) T();
+        (void)m_freeBlocks.enqueue(pBlock, 0);
+      }
+    }
+    /* The memory allocation is not successfully. */
+    else {
+      debug_break;
+    }
+  }
+
+  BlockPool(BlockPool const &) = delete;
+  BlockPool &operator=(BlockPool const &) = delete;
+
+  /* destructor, all the handles have to be returned by now. */
+  ~BlockPool() {
+    if (m_pBlocks != nullptr) {
+      for (size_t index = 0U; index < N; ++index) {
+        m_pBlocks[index].~T();
+      }
+      MemoryManager::release_block(m_pBlocks);
+    }
+  }
+
+  /**
+   * @brief   Takes a free block from the pool.
+   *
+   * @param   wait_time Time to wait for a block to be released, has to be 0
+   * from an ISR.
+   * @return  Handle Owning handle, empty if no block got free in time.
+   */
+  Handle acquire(delay_t wait_time) {
+    T *pBlock = nullptr;
+    if (m_freeBlocks.dequeue(pBlock, wait_time) != RET_STA_E::eRTOSSuccess) {
+      pBlock = nullptr;
+    }
+    return Handle(this, pBlock);
+  }
+
+  /**
+   * @brief   Takes back the ownership of a block given up by Handle::release.
+   *
+   * @param   pBlock Block of this pool.
+   * @return  Handle Owning handle to the block.
+   */
+  Handle adopt(T *const pBlock) { return Handle(this, pBlock); }
+
+  /**
+   * @brief   Returns a block to the pool. Never blocks.
+   *
+   * @param   pBlock Block of this pool.
+   */
+  void release(T *const pBlock) { (void)m_freeBlocks.enqueue(pBlock, 0); }
+
+  static constexpr size_t capacity() { return N; }
+
+private:
+  T *m_pBlocks;                /**< Storage of all the blocks.             */
+  TQueue<T *, N> m_freeBlocks; /**< Pointers to the free blocks.           */
+};
+} // namespace RTOS
+#endif // RTOS_BLOCK_POOL_HPP
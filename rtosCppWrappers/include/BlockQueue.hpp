@@ -0,0 +1,107 @@
+/**
+ * @file        BlockQueue.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the zero-copy queue transporting pool blocks.
+ * @version     0.1
+ * @date        2021-07-26
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_BLOCK_QUEUE_HPP
+#define RTOS_BLOCK_QUEUE_HPP
+
+#include "BlockPool.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief       Queue that moves the ownership of pool blocks between threads.
+ *
+ *              Only the pointer to the block goes through the kernel queue, the
+ * payload is written once in place by the sender and read in place by the
+ * receiver.
+ *
+ * @tparam T    Type of the block.
+ * @tparam PoolN Number of blocks in the pool.
+ * @tparam QueueN Number of blocks the queue can hold.
+ */
+template <typename T, size_t PoolN, size_t QueueN = PoolN> class BlockQueue {
+public:
+  using pool_t = BlockPool<T, PoolN>;
+  using handle_t = typename pool_t::Handle;
+
+  /**
+   * @brief Construct a new BlockQueue object.
+   *
+   * @param rPool Pool all the transported blocks belong to.
+   */
+  explicit BlockQueue(pool_t &rPool) : m_rPool(rPool), m_queue() {}
+
+  BlockQueue(BlockQueue const &) = delete;
+  BlockQueue &operator=(BlockQueue const &) = delete;
+
+  ~BlockQueue() {
+    /* Return the blocks that were never received. */
+    T *pBlock = nullptr;
+    while (m_queue.try_dequeue(pBlock)) {
+      m_rPool.release(pBlock);
+    }
+  }
+
+  /**
+   * @brief   Sends the block to the back of the queue.
+   *
+   * @param   rBlock Handle to the block. It is emptied if the block is sent and
+   * keeps the block otherwise.
+   * @param   wait_time Time to wait for space on the queue.
+   * @return  RET_STA_E eRTOSSuccess if the block is sent before the time-out.
+   */
+  RET_STA_E send(handle_t &rBlock, delay_t wait_time) {
+    RET_STA_E ret_val = RET_STA_E::eRTOSFailure;
+    if (rBlock) {
+      T *const pBlock = rBlock.get();
+      ret_val = m_queue.enqueue(pBlock, wait_time);
+      /* The receiver owns the block now. */
+      if (ret_val == RET_STA_E::eRTOSSuccess) {
+        (void)rBlock.release();
+      }
+    }
+    return ret_val;
+  }
+
+  /**
+   * @brief   Sends the block to the back of the queue, waits forever.
+   *
+   * @param   rBlock Handle to the block, emptied once sent.
+   */
+  void send(handle_t &rBlock) { (void)send(rBlock, wait_forever); }
+
+  /**
+   * @brief   Receives a block from the queue.
+   *
+   * @param   wait_time Time to wait for a block.
+   * @return  handle_t Owning handle, empty if nothing is received in time.
+   */
+  handle_t receive(delay_t wait_time) {
+    T *pBlock = nullptr;
+    if (m_queue.dequeue(pBlock, wait_time) != RET_STA_E::eRTOSSuccess) {
+      pBlock = nullptr;
+    }
+    return m_rPool.adopt(pBlock);
+  }
+
+  /**
+   * @brief   Receives a block from the queue, waits forever.
+   *
+   * @return  handle_t Owning handle to the block.
+   */
+  handle_t receive() { return receive(wait_forever); }
+
+private:
+  pool_t &m_rPool;             /**< Pool of the transported blocks.         */
+  TQueue<T *, QueueN> m_queue; /**< Transports the pointers to the blocks.  */
+};
+} // namespace RTOS
+#endif // RTOS_BLOCK_QUEUE_HPP
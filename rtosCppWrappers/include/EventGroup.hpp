@@ -0,0 +1,106 @@
+/**
+ * @file        EventGroup.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the event group for waits on several conditions.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_EVENT_GROUP_HPP
+#define RTOS_EVENT_GROUP_HPP
+
+#include "rtos_types.hpp"
+
+namespace RTOS {
+
+using event_bits_t = EventBits_t;
+
+/**
+ * @brief   Set of event bits threads can wait on, for any or all of them.
+ *
+ *          The control block is a member of the object, so an event group
+ * cannot be copied or moved. The kernel keeps the upper 8 bits for itself.
+ *
+ *          From an ISR the bits are set and cleared through the timer daemon
+ * of the kernel, so this needs configUSE_TIMERS. The waits cannot be used from
+ * an ISR.
+ */
+class EventGroup {
+public:
+  /** Bits the application can use. */
+  static constexpr event_bits_t ALL_BITS =
+      (configUSE_16_BIT_TICKS == 1) ? 0x00FFU : 0x00FFFFFFUL;
+
+  EventGroup();
+  ~EventGroup();
+
+  EventGroup(EventGroup const &) = delete;
+  EventGroup &operator=(EventGroup const &) = delete;
+
+  /**
+   * @brief   Sets the bits, waking the threads whose wait is met.
+   *
+   * @return  true if the bits are set, from an ISR if the set is posted to the
+   * timer daemon.
+   */
+  bool set(event_bits_t bits);
+
+  /**
+   * @brief   Clears the bits.
+   *
+   * @return  true if the bits are cleared, from an ISR if the clear is posted
+   * to the timer daemon.
+   */
+  bool clear(event_bits_t bits);
+
+  /**
+   * @brief   Current value of the bits.
+   */
+  event_bits_t get() const;
+
+  /**
+   * @brief   Waits until any of the bits is set.
+   *
+   * @param   bits Bits to wait for.
+   * @param   timeout Longest time to wait.
+   * @param   isClearOnExit true clears the bits waited for when the wait is
+   * met.
+   * @return  event_bits_t Value of the bits when the wait ended, before the
+   * clear. The wait timed out if none of the bits is set in it.
+   */
+  event_bits_t wait_any(event_bits_t bits, delay_t timeout,
+                        bool isClearOnExit = true);
+
+  /**
+   * @brief   Waits until all the bits are set.
+   *
+   * @return  event_bits_t Value of the bits when the wait ended, before the
+   * clear. The wait timed out if not all the bits are set in it.
+   */
+  event_bits_t wait_all(event_bits_t bits, delay_t timeout,
+                        bool isClearOnExit = true);
+
+  /**
+   * @brief   Rendezvous of several threads. Sets the bits of the caller and
+   * waits for the bits of all the threads in a single atomic step.
+   *
+   * @param   set_bits Bits of the calling thread.
+   * @param   wait_bits Bits of all the threads meeting, cleared once all are
+   * set.
+   * @param   timeout Longest time to wait.
+   * @return  true if all the threads met before the timeout.
+   */
+  bool sync(event_bits_t set_bits, event_bits_t wait_bits, delay_t timeout);
+
+private:
+  event_bits_t wait(event_bits_t bits, delay_t timeout, bool isClearOnExit,
+                    bool isWaitForAll);
+
+  StaticEventGroup_t m_eventGroupCB; /**< Control block of the group. */
+  EventGroupHandle_t m_handle;       /**< nullptr if creation failed. */
+};
+} // namespace RTOS
+#endif // RTOS_EVENT_GROUP_HPP
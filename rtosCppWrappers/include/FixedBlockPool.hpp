@@ -0,0 +1,92 @@
+/**
+ * @file        FixedBlockPool.hpp
+ * @author      Tummala Manish (manish.tummala@gmail.com)
+ * @brief       Implements the fixed size block pool used by the memory
+ * manager.
+ * @version     0.1
+ * @date        2021-07-27
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_FIXED_BLOCK_POOL_HPP
+#define RTOS_FIXED_BLOCK_POOL_HPP
+
+#include "rtos_types.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   Pool of equally sized blocks over a caller provided arena.
+ *
+ *          Allocating and releasing are O(1) and never coalesce. The blocks
+ * that were never handed out are taken in order from the arena, the released
+ * ones are kept on an intrusive free list. As the constructor is constexpr a
+ * pool with static storage is ready before any other static object is built.
+ */
+class FixedBlockPool {
+  uint8_t *m_pArena;    /**< Start of the arena holding all the blocks.    */
+  size_t m_blockSize;   /**< Size of each block, a multiple of alignment.  */
+  size_t m_blockCount;  /**< Number of blocks in the arena.                */
+  size_t m_nextUnused;  /**< Index of the first block never handed out.    */
+  void *m_pFreeHead;    /**< Head of the released blocks.                  */
+
+public:
+  /**
+   * @brief   Rounds the size up to a block size usable by the pool.
+   *
+   * @param   size Requested size of a block in bytes.
+   * @return  size_t Block size in bytes.
+   */
+  static constexpr size_t block_size_for(size_t const size) {
+    size_t const min_size = size < sizeof(void *) ? sizeof(void *) : size;
+    return (min_size + (portBYTE_ALIGNMENT - 1U)) &
+           ~static_cast<size_t>(portBYTE_ALIGNMENT - 1U);
+  }
+
+  /**
+   * @brief   Construct a new pool.
+   *
+   * @param   pArena Arena of at least block_size_for(blockSize) * blockCount
+   * bytes aligned to portBYTE_ALIGNMENT.
+   * @param   blockSize Size of each block in bytes.
+   * @param   blockCount Number of blocks in the arena.
+   */
+  constexpr FixedBlockPool(uint8_t *const pArena, size_t const blockSize,
+                           size_t const blockCount)
+      : m_pArena(pArena), m_blockSize(block_size_for(blockSize)),
+        m_blockCount(blockCount), m_nextUnused(0U), m_pFreeHead(nullptr) {}
+
+  FixedBlockPool(FixedBlockPool const &) = delete;
+  FixedBlockPool &operator=(FixedBlockPool const &) = delete;
+
+  /**
+   * @brief   Takes a block from the pool.
+   *
+   * @return  void* The block, nullptr if the pool is exhausted.
+   */
+  void *allocate();
+
+  /**
+   * @brief   Returns a block to the pool.
+   *
+   * @param   pBlock Block handed out by this pool.
+   */
+  void release(void *pBlock);
+
+  /**
+   * @brief   Checks if the memory is a block of this pool.
+   *
+   * @param   pMemory Pointer to be checked.
+   * @return  true if the pointer lies in the arena of this pool.
+   */
+  bool owns(const void *pMemory) const;
+
+  /**
+   * @brief   Size of each block of the pool in bytes.
+   */
+  size_t block_size() const { return m_blockSize; }
+};
+} // namespace RTOS
+#endif // RTOS_FIXED_BLOCK_POOL_HPP
@@ -15,6 +15,8 @@
 
 #include "rtos_types.hpp"
 
+#include <type_traits>
+
 namespace RTOS {
 
 /**
@@ -25,6 +27,46 @@ enum eMemoryResult {
   eMemAllocationSuccess,    /**< if the allocation has failed.    */
 };
 
+/**
+ * @brief:  enumerates the pools dedicated to the kernel control blocks.
+ */
+enum class cb_pool_e {
+  eNoCBPool = 0, /**< control block is served like any other block.     */
+  eTaskCBPool,   /**< pool of StaticTask_t.                             */
+  eQueueCBPool,  /**< pool of StaticQueue_t, same as StaticSemaphore_t. */
+};
+
+/**
+ * @brief:  enumerates the categories the memory usage is accounted under.
+ */
+enum class mem_category_e {
+  eStackMemory = 0,    /**< thread stacks.                               */
+  eControlBlockMemory, /**< kernel control blocks.                       */
+  eBlockMemory,        /**< generic blocks e.g. queue buffers.           */
+  eCategoryCount,      /**< number of categories, not a category.        */
+};
+
+/**
+ * @brief   Memory usage of a single category.
+ *
+ *          Heap allocations are accounted with the heap's own overhead.
+ */
+struct mem_usage_s {
+  size_t current_bytes;        /**< bytes held right now.                  */
+  size_t peak_bytes;           /**< highest current_bytes seen.            */
+  uint32_t allocation_count;   /**< successful allocations so far.         */
+  uint32_t failed_allocations; /**< failed allocations so far.             */
+};
+
+/**
+ * @brief   State of the RTOS heap i.e. configTOTAL_HEAP_SIZE.
+ */
+struct heap_stats_s {
+  size_t free_bytes;           /**< bytes free right now.                  */
+  size_t min_ever_free_bytes;  /**< lowest free_bytes seen.                */
+  size_t largest_free_block;   /**< largest single allocation possible.    */
+};
+
 /**
  * @brief   Implements the memory manager using the underlying RTOS memory
  * allocation schemes.
@@ -33,6 +75,11 @@ enum eMemoryResult {
  * maintained. Any allocation should be done after a call to the get_instance
  * static function.
  *
+ *          When configured (see memoryManagerConfiguration.cmake) the requests
+ * are first served in O(1) from fixed size pools: the control blocks from
+ * their dedicated pools and the blocks and stacks from the smallest fitting
+ * size class. The RTOS heap is used only when no pool can serve the request.
+ *
  */
 class MemoryManager {
   /*------------- Static Members -------------*/
@@ -41,9 +88,16 @@ class MemoryManager {
    */
   static MemoryManager m_rMemoryManager;
 
-  // This can be improved to maintain memory usage.
-  explicit MemoryManager(); /**< No object can be instantiated using this class
-                             */
+  /*---------------------- Non-static data members -------------------------*/
+  /**
+   * @brief   Usage of each of the mem_category_e.
+   */
+  mem_usage_s m_usage[static_cast<size_t>(mem_category_e::eCategoryCount)];
+
+  /* Constant initialized so the allocations done by the constructors of other
+   * static objects are not wiped out. */
+  constexpr MemoryManager() : m_usage() {} /**< No object can be instantiated
+                                              using this class */
 
 public:
   /**
@@ -118,7 +172,7 @@ public:
    * successful else the opposite.
    */
   eMemoryResult get_CB(T **ppCB) {
-    *ppCB = static_cast<T *>(pvPortMalloc(sizeof(T)));
+    *ppCB = static_cast<T *>(allocate_CB(sizeof(T), cb_pool_of<T>()));
     return *ppCB != nullptr ? eMemAllocationSuccess : eMemAllocationFailed;
   }
   /**
@@ -131,6 +185,77 @@ public:
    * @param   ppStack pointer to the stack that has been assigned.
    */
   static void release_CB(void *pCB);
+
+  /**
+   * @brief   Returns the memory usage of a category.
+   *
+   * @param   category one of the mem_category_e except eCategoryCount.
+   * @return  mem_usage_s snapshot of the usage.
+   */
+  mem_usage_s get_usage(mem_category_e category) const;
+
+  /**
+   * @brief   Returns the state of the RTOS heap.
+   *
+   * @return  heap_stats_s snapshot of the heap.
+   */
+  static heap_stats_s get_heap_stats();
+
+private:
+  /**
+   * @brief   Maps the control block type to its dedicated pool.
+   */
+  template <typename T> static constexpr cb_pool_e cb_pool_of() {
+    if constexpr (std::is_same_v<T, StaticTask_t>) {
+      return cb_pool_e::eTaskCBPool;
+    } else if constexpr (std::is_same_v<T, StaticQueue_t>) {
+      return cb_pool_e::eQueueCBPool;
+    } else {
+      return cb_pool_e::eNoCBPool;
+    }
+  }
+
+  /**
+   * @brief   Allocates a control block from its pool or else the heap.
+   *
+   * @param   iNumBytes size of the control block.
+   * @param   pool pool dedicated to the control block type.
+   * @return  void* pointer to the control block, nullptr if failed.
+   */
+  void *allocate_CB(size_t iNumBytes, cb_pool_e pool);
+
+  /**
+   * @brief   Allocates from the smallest fitting size class or else the heap.
+   *
+   * @param   iNumBytes number of bytes to be allocated.
+   * @param   category category the allocation is accounted under.
+   * @return  void* pointer to the memory, nullptr if failed.
+   */
+  void *allocate(size_t iNumBytes, mem_category_e category);
+
+  /**
+   * @brief   Returns the memory to the pool it belongs to or else the heap.
+   *
+   * @param   pMemory memory allocated by this memory manager.
+   * @param   category category the allocation was accounted under.
+   */
+  static void release(void *pMemory, mem_category_e category);
+
+  /**
+   * @brief   Updates the usage of a category after an allocation attempt.
+   *
+   * @param   category category of the allocation.
+   * @param   iNumBytes bytes taken, 0 if the allocation failed.
+   */
+  void account_allocation(mem_category_e category, size_t iNumBytes);
+
+  /**
+   * @brief   Updates the usage of a category after a release.
+   *
+   * @param   category category of the released memory.
+   * @param   iNumBytes bytes given back.
+   */
+  void account_release(mem_category_e category, size_t iNumBytes);
 };
 } // namespace RTOS
 #endif // RTOS_MEM_MNG_HPP
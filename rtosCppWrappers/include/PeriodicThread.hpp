@@ -0,0 +1,105 @@
+/**
+ * @file        PeriodicThread.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the thread that runs its work at a fixed period.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_PERIODIC_THREAD_HPP
+#define RTOS_PERIODIC_THREAD_HPP
+
+#include "Thread.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   Timing statistics of a periodic thread. Jitter is the number of
+ * ticks the thread woke up later than its scheduled wake time.
+ */
+struct period_stats_s {
+  uint32_t period_count;  /**< Number of periods run.                       */
+  uint32_t overrun_count; /**< Periods that ended after the next wake time. */
+  TickType_t last_jitter; /**< Jitter of the latest period.                 */
+  TickType_t max_jitter;  /**< Largest jitter seen.                         */
+  uint64_t total_jitter;  /**< Sum of the jitter of all periods.            */
+};
+
+/**
+ * @brief   Thread that calls run_period() once every period.
+ *
+ *          The wake times are kept on a fixed grid from the first wake-up, so
+ * the time taken by run_period() does not make the thread drift. When a period
+ * over-runs the missed wake times are skipped and the thread continues on the
+ * same grid.
+ */
+class PeriodicThread : public Thread {
+public:
+  explicit PeriodicThread() = delete;
+
+  /**
+   * @brief   PeriodicThread constructor.
+   *
+   * @param   thread_name Name of the thread.
+   * @param   thread_priority Thread priority.
+   * @param   thread_stack_size Thread stack size.
+   * @param   period Period at which run_period() is called, at least a tick.
+   * @param   thread_id Requested id, by default 0 lets the ThreadRegistry
+   * assign a free one.
+   */
+  PeriodicThread(name_t thread_name, priority_t thread_priority,
+                 stack_size_t thread_stack_size, delay_t period,
+                 id_t thread_id = 0);
+
+  /**
+   * @brief   Period of the thread.
+   */
+  delay_t get_period() const { return m_period; }
+
+  /**
+   * @brief   Copy of the statistics, safe to call from any thread.
+   */
+  period_stats_s get_period_stats() const;
+
+  /**
+   * @brief   Clears the statistics.
+   */
+  void reset_period_stats();
+
+  /**
+   * @brief   Ends the thread after the running period is over.
+   */
+  void stop() { m_isStopRequested = true; }
+
+protected:
+  /**
+   * @brief   Work of a single period that the inheriting classes implement.
+   */
+  virtual void run_period() = 0;
+
+  /**
+   * @brief   Called when a period over-ran. Does nothing by default.
+   *
+   * @param   late_ticks Number of ticks the period ended after the next wake
+   * time.
+   */
+  virtual void on_overrun(TickType_t late_ticks) { (void)late_ticks; }
+
+private:
+  void run() final;
+
+  /**
+   * @brief   Waits for the next wake time and updates the statistics.
+   */
+  void wait_for_next_period();
+
+  delay_t const m_period;          /**< Period of the thread.               */
+  TickType_t m_lastWakeTime;       /**< Scheduled time of the last wake-up. */
+  period_stats_s m_stats;          /**< Timing statistics.                  */
+  volatile bool m_isStopRequested; /**< Set by stop().                      */
+};
+} // namespace RTOS
+#endif // RTOS_PERIODIC_THREAD_HPP
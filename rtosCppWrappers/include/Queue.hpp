@@ -24,6 +24,7 @@ class Queue : public IQueueSender, public IQueueReceiver {
   queue_cb_t
       m_pQueueCB; /**< Holds pointer buffer for the queue control block     */
   uint8_t *m_pBuffer; /**< Holds pointer buffer for the entire queue */
+  size_t m_itemLength; /**< Holds the number of bytes of each unit of queue */
 
 public:
   /**
@@ -43,12 +44,16 @@ public:
   RET_STA_E enqueue(const void *constpv_item_to_queue,
                                delay_t wait_time) override;
   void enqueue(const void *pv_item_to_queue) override;
-  
+  size_t enqueue_n(const void *pv_items, size_t item_count,
+                   delay_t wait_time) override;
+
   /*------------------------ Inherited from receiver -------------------------*/
   RET_STA_E dequeue(void *constpv_buffer, delay_t wait_time) override;
   void dequeue(void *pv_buffer) override;
   RET_STA_E peek(void *constpv_buffer, delay_t wait_time) override;
   void peek(void *buffer) override;
+  size_t dequeue_n(void *pv_buffer, size_t item_count,
+                   delay_t wait_time) override;
 };
 } // namespace RTOS
 #endif // RTOS_THREAD_HPP
@@ -0,0 +1,59 @@
+/**
+ * @file        QueueBatch.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Batch transfer helpers shared by the queue wrappers.
+ * @version     0.1
+ * @date        2021-07-25
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_QUEUE_BATCH_HPP
+#define RTOS_QUEUE_BATCH_HPP
+
+#include "rtos_types.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   Posts up to item_count items to the back of the queue.
+ *
+ *          Only the first item waits for up to wait_time. The remaining items
+ * are posted with no wait inside a single critical section, so no other
+ * thread or ISR sees a part of the batch and a reader woken by it runs after
+ * the whole batch. The interrupts stay masked while the
+ * items are copied, keep the batches short. From an ISR every item uses the
+ * ISR flavour and a single yield is done at the end, wait_time has to be 0
+ * there.
+ *
+ * @param   handle Queue to post to.
+ * @param   pItems Items placed back to back.
+ * @param   item_size Size of a single item in bytes.
+ * @param   item_count Number of items in pItems.
+ * @param   wait_time Time to wait for space for the first item.
+ * @return  size_t Number of items posted.
+ */
+size_t queue_send_n(que_handle_t handle, const uint8_t *pItems,
+                    size_t item_size, size_t item_count, delay_t wait_time);
+
+/**
+ * @brief   Receives up to item_count items from the queue.
+ *
+ *          Only the first item waits for up to wait_time. The remaining items
+ * are taken with no wait inside a single critical section, like
+ * queue_send_n. From an ISR every item uses the ISR flavour and a single yield
+ * is done at the end, wait_time has to be 0 there.
+ *
+ * @param   handle Queue to receive from.
+ * @param   pBuffer Buffer for item_count items placed back to back.
+ * @param   item_size Size of a single item in bytes.
+ * @param   item_count Maximum number of items to receive.
+ * @param   wait_time Time to wait for the first item.
+ * @return  size_t Number of items received.
+ */
+size_t queue_receive_n(que_handle_t handle, uint8_t *pBuffer,
+                       size_t item_size, size_t item_count, delay_t wait_time);
+
+} // namespace RTOS
+#endif // RTOS_QUEUE_BATCH_HPP
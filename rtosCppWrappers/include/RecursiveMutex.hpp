@@ -0,0 +1,47 @@
+/**
+ * @file      RecursiveMutex.hpp
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Implements the mutex interface for a recursive mutex.
+ * @version   0.1
+ * @date      30-07-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_CPP_WRAPPER_RECURSIVE_MUTEX_HPP
+#define RTOS_CPP_WRAPPER_RECURSIVE_MUTEX_HPP
+
+#include "Mutex.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief FreeRTOS flavour of the recursive mutex.
+ *
+ *        The holder can lock the mutex again without blocking, the mutex is
+ * released once it is unlocked as many times as it was locked. Recursive
+ * mutexes cannot be used from an ISR.
+ */
+class RecursiveMutex : public IMutex {
+  mutex_handle m_mutexHandle; /**< Mutex handler. */
+  mutex_cb *m_pMutexCB;       /**< Control block for the mutex. */
+  bool m_isMutexCreated;
+
+public:
+  ~RecursiveMutex() override = default;
+
+  explicit RecursiveMutex();
+
+  /*------------------------------ IMutex interface
+   * --------------------------*/
+  bool create() override;
+  bool lock(RTOS::delay_t timeOut) override;
+  bool lock() override;
+  bool unlock() override;
+  bool remove() override;
+  bool is_mutex_created() const override;
+};
+} // namespace RTOS
+
+#endif // RTOS_CPP_WRAPPER_RECURSIVE_MUTEX_HPP
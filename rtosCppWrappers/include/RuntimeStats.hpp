@@ -0,0 +1,105 @@
+/**
+ * @file        RuntimeStats.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Provides the CPU usage of the threads from the kernel run time
+ * statistics.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_RUNTIME_STATS_HPP
+#define RTOS_RUNTIME_STATS_HPP
+
+#include "rtos_types.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   CPU usage of a single thread. The run time is counted in ticks of
+ * the run time counter, configRUN_TIME_COUNTER_HZ per second.
+ */
+struct runtime_stats_s {
+  uint32_t run_time;         /**< Cumulative time the thread ran.         */
+  uint8_t load_percent;      /**< Share of the total run time, 0 to 100.  */
+  uint32_t context_switches; /**< Number of times the thread got the CPU. */
+};
+
+/**
+ * @brief   Entry of a system wide snapshot.
+ */
+struct thread_runtime_s {
+  name_t name;           /**< Name, valid as long as the thread exists.    */
+  thr_handle_t handle;   /**< Handle of the thread.                       */
+  runtime_stats_s stats; /**< CPU usage of the thread.                    */
+};
+
+/**
+ * @brief   Time passed since the scheduler started, in run time counter
+ * ticks.
+ */
+uint32_t get_total_run_time();
+
+/**
+ * @brief   CPU usage of the given thread.
+ *
+ * @param   handle Handle of a created thread.
+ * @return  runtime_stats_s All zero if run time stats are not generated.
+ */
+runtime_stats_s get_runtime_stats(thr_handle_t handle);
+
+/**
+ * @brief   Takes the CPU usage of all the threads in the system at once.
+ *
+ * @param   pTaskStatus Scratch buffer of count entries for the kernel.
+ * @param   pThreads Buffer of count entries that receives the snapshot.
+ * @param   count Number of entries in both the buffers.
+ * @param   rTotalRunTime Receives the total run time of the snapshot.
+ * @return  size_t Number of threads in the snapshot, 0 if there are more
+ * threads in the system than count.
+ */
+size_t capture_runtime_stats(TaskStatus_t *pTaskStatus,
+                             thread_runtime_s *pThreads, size_t count,
+                             uint32_t &rTotalRunTime);
+
+/**
+ * @brief   Snapshot of the CPU usage of all the threads.
+ *
+ * @tparam  MaxThreads Most threads the snapshot can hold, including the idle
+ * and the timer threads of the kernel.
+ */
+template <size_t MaxThreads> class RuntimeSnapshot {
+public:
+  RuntimeSnapshot()
+      : m_taskStatus(), m_threads(), m_threadCount(0U), m_totalRunTime(0U) {}
+
+  /**
+   * @brief   Takes a new snapshot replacing the previous one.
+   *
+   * @return  true if all the threads fit in the snapshot.
+   */
+  bool capture() {
+    m_threadCount = capture_runtime_stats(m_taskStatus, m_threads, MaxThreads,
+                                          m_totalRunTime);
+    return m_threadCount > 0U;
+  }
+
+  size_t size() const { return m_threadCount; }
+  uint32_t total_run_time() const { return m_totalRunTime; }
+
+  thread_runtime_s const &operator[](size_t const index) const {
+    return m_threads[index];
+  }
+  thread_runtime_s const *begin() const { return &m_threads[0]; }
+  thread_runtime_s const *end() const { return &m_threads[m_threadCount]; }
+
+private:
+  TaskStatus_t m_taskStatus[MaxThreads]; /**< Scratch buffer of the kernel. */
+  thread_runtime_s m_threads[MaxThreads]; /**< Threads in the snapshot.     */
+  size_t m_threadCount;    /**< Number of threads in the snapshot.          */
+  uint32_t m_totalRunTime; /**< Total run time when the snapshot was taken. */
+};
+} // namespace RTOS
+#endif // RTOS_RUNTIME_STATS_HPP
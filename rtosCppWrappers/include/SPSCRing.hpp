@@ -0,0 +1,154 @@
+/**
+ * @file        SPSCRing.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the lock-free single producer single consumer ring.
+ * @version     0.1
+ * @date        2021-07-25
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_SPSC_RING_HPP
+#define RTOS_SPSC_RING_HPP
+
+#include "ISignal.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+namespace RTOS {
+
+/**
+ * @brief       Lock-free ring buffer for exactly one producer and one consumer.
+ *
+ *              The producer can be an ISR or a thread. Neither push nor pop
+ * enters a critical section, the indices are atomics that only one side ever
+ * writes. When a consumer is attached it is notified only when the ring goes
+ * from empty to non-empty, so the consumer has to drain the ring till pop
+ * fails before waiting for the next notification.
+ *
+ * @tparam T    Type of the ring item.
+ * @tparam N    Number of ring items to hold, has to be a power of two.
+ */
+template <typename T, size_t N> class SPSCRing {
+  static_assert(N > 0 && (N & (N - 1)) == 0,
+                "RTOS: Ring capacity has to be a power of two.");
+  static_assert(std::is_trivially_copyable_v<T>,
+                "RTOS: Ring items have to be trivially copyable.");
+
+#ifdef SIM
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+#else
+  static constexpr size_t CACHE_LINE_SIZE = 32;
+#endif
+  static constexpr size_t INDEX_MASK = N - 1;
+
+  /*---------------------- Non-static data members -------------------------*/
+  /* Indices are free running and are masked on access. Each one is on its own
+   * cache line so the producer and the consumer do not share a line. */
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head; /**< Written by push. */
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail; /**< Written by pop.  */
+  alignas(CACHE_LINE_SIZE) T m_items[N];    /**< Storage for the items.     */
+  ISignal *m_pConsumer;                     /**< Notified on empty -> data. */
+  notify_value_t m_notifyBits;              /**< Bits set on the consumer.  */
+
+public:
+  /**
+   * @brief   Construct a new ring.
+   *
+   * @param   pConsumer Consumer to be notified when the ring gets data after
+   * being empty. No notification is sent if nullptr.
+   * @param   notifyBits Notification bits set on the consumer.
+   */
+  explicit SPSCRing(ISignal *const pConsumer = nullptr,
+                    notify_value_t const notifyBits = 0x01U)
+      : m_head(0U), m_tail(0U), m_items(), m_pConsumer(pConsumer),
+        m_notifyBits(notifyBits) {}
+
+  SPSCRing(SPSCRing const &) = delete;
+  SPSCRing &operator=(SPSCRing const &) = delete;
+
+  /**
+   * @brief   Attaches the consumer to be notified.
+   *
+   *          Has to be called before the producer starts pushing.
+   *
+   * @param   pConsumer Consumer to be notified.
+   * @param   notifyBits Notification bits set on the consumer.
+   */
+  void attach_consumer(ISignal *const pConsumer,
+                       notify_value_t const notifyBits) {
+    m_pConsumer = pConsumer;
+    m_notifyBits = notifyBits;
+  }
+
+  /**
+   * @brief   Places the item in the ring. Only the producer calls this.
+   *
+   * @param   item Item to be placed.
+   * @return  true if the item is placed, false if the ring is full.
+   */
+  bool push(const T &item) {
+    size_t const head = m_head.load(std::memory_order_relaxed);
+    size_t const tail = m_tail.load(std::memory_order_acquire);
+
+    /* Ring is full. */
+    if ((head - tail) == N) {
+      return false;
+    }
+
+    m_items[head & INDEX_MASK] = item;
+    m_head.store(head + 1U, std::memory_order_seq_cst);
+
+    /*
+     * Wake the consumer only on the empty to non-empty transition i.e. when it
+     * had taken every item before this one and might be waiting. Together
+     * with the seq_cst pair in pop either the consumer sees the new head or
+     * this sees the drained tail, so no wake-up is lost.
+     */
+    if ((m_pConsumer != nullptr) &&
+        (m_tail.load(std::memory_order_seq_cst) == head)) {
+      (void)m_pConsumer->notify(m_notifyBits, ISignal::NTF_TYP_E::eSetBits);
+    }
+    return true;
+  }
+
+  /**
+   * @brief   Takes the oldest item out of the ring. Only the consumer calls
+   * this.
+   *
+   * @param   item [out] Holds the item taken.
+   * @return  true if an item is taken, false if the ring is empty.
+   */
+  bool pop(T &item) {
+    size_t const tail = m_tail.load(std::memory_order_relaxed);
+    size_t const head = m_head.load(std::memory_order_seq_cst);
+
+    /* Ring is empty. */
+    if (head == tail) {
+      return false;
+    }
+
+    item = m_items[tail & INDEX_MASK];
+    m_tail.store(tail + 1U, std::memory_order_seq_cst);
+    return true;
+  }
+
+  /**
+   * @brief   Number of items in the ring, a snapshot only.
+   */
+  size_t size() const {
+    /* Tail is read first so the head read after it is never behind. */
+    size_t const tail = m_tail.load(std::memory_order_acquire);
+    return m_head.load(std::memory_order_acquire) - tail;
+  }
+
+  bool empty() const { return size() == 0U; }
+
+  bool full() const { return size() == N; }
+
+  static constexpr size_t capacity() { return N; }
+};
+} // namespace RTOS
+#endif // RTOS_SPSC_RING_HPP
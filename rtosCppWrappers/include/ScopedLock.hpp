@@ -0,0 +1,191 @@
+/**
+ * @file        ScopedLock.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the lock guards that hold a mutex for a scope.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_SCOPED_LOCK_HPP
+#define RTOS_SCOPED_LOCK_HPP
+
+#include "IMutex.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   Tags that select how a UniqueLock takes the mutex on construction.
+ */
+struct defer_lock_t {
+  explicit defer_lock_t() = default;
+};
+struct try_to_lock_t {
+  explicit try_to_lock_t() = default;
+};
+struct adopt_lock_t {
+  explicit adopt_lock_t() = default;
+};
+
+inline constexpr defer_lock_t defer_lock{};   /**< Does not lock.          */
+inline constexpr try_to_lock_t try_to_lock{}; /**< Locks without waiting.  */
+inline constexpr adopt_lock_t adopt_lock{};   /**< Already locked by caller. */
+
+/**
+ * @brief   Holds the mutex from the construction to the end of the scope.
+ *
+ *          The mutex is taken waiting forever, so the guard owns it unless the
+ * mutex was never created. It is unlocked on every path out of the scope.
+ */
+class ScopedLock {
+public:
+  explicit ScopedLock(IMutex &rMutex)
+      : m_rMutex(rMutex), m_isOwned(rMutex.lock(wait_forever)) {}
+
+  /**
+   * @brief   Takes over a mutex the caller already locked.
+   */
+  ScopedLock(IMutex &rMutex, adopt_lock_t)
+      : m_rMutex(rMutex), m_isOwned(true) {}
+
+  ~ScopedLock() {
+    if (m_isOwned) {
+      (void)m_rMutex.unlock();
+    }
+  }
+
+  ScopedLock(ScopedLock const &) = delete;
+  ScopedLock &operator=(ScopedLock const &) = delete;
+
+  /**
+   * @brief   false only if the mutex could not be taken.
+   */
+  bool owns_lock() const { return m_isOwned; }
+  explicit operator bool() const { return m_isOwned; }
+
+private:
+  IMutex &m_rMutex;
+  bool const m_isOwned;
+};
+
+/**
+ * @brief   Movable owner of a mutex that can be locked and unlocked in the
+ * scope.
+ *
+ *          The ownership moves with the object, so a locked mutex can be
+ * handed to another scope. The mutex is unlocked when an owning object is
+ * destroyed.
+ */
+class UniqueLock {
+public:
+  UniqueLock() : m_pMutex(nullptr), m_isOwned(false) {}
+
+  /**
+   * @brief   Locks the mutex waiting forever.
+   */
+  explicit UniqueLock(IMutex &rMutex)
+      : m_pMutex(&rMutex), m_isOwned(rMutex.lock(wait_forever)) {}
+
+  /**
+   * @brief   Locks the mutex waiting at most the timeout.
+   */
+  UniqueLock(IMutex &rMutex, delay_t const timeout)
+      : m_pMutex(&rMutex), m_isOwned(rMutex.lock(timeout)) {}
+
+  UniqueLock(IMutex &rMutex, defer_lock_t)
+      : m_pMutex(&rMutex), m_isOwned(false) {}
+
+  UniqueLock(IMutex &rMutex, try_to_lock_t)
+      : m_pMutex(&rMutex), m_isOwned(rMutex.lock(delay_t(0U))) {}
+
+  UniqueLock(IMutex &rMutex, adopt_lock_t)
+      : m_pMutex(&rMutex), m_isOwned(true) {}
+
+  ~UniqueLock() {
+    if (m_isOwned) {
+      (void)m_pMutex->unlock();
+    }
+  }
+
+  UniqueLock(UniqueLock const &) = delete;
+  UniqueLock &operator=(UniqueLock const &) = delete;
+
+  UniqueLock(UniqueLock &&rOther)
+      : m_pMutex(rOther.m_pMutex), m_isOwned(rOther.m_isOwned) {
+    rOther.m_pMutex = nullptr;
+    rOther.m_isOwned = false;
+  }
+
+  UniqueLock &operator=(UniqueLock &&rOther) {
+    if (this != &rOther) {
+      if (m_isOwned) {
+        (void)m_pMutex->unlock();
+      }
+      m_pMutex = rOther.m_pMutex;
+      m_isOwned = rOther.m_isOwned;
+      rOther.m_pMutex = nullptr;
+      rOther.m_isOwned = false;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief   Locks the mutex waiting forever.
+   * @return  false if there is no mutex, it is already owned or not created.
+   */
+  bool lock() { return try_lock_for(wait_forever); }
+
+  /**
+   * @brief   Locks the mutex if it is free, without waiting.
+   */
+  bool try_lock() { return try_lock_for(delay_t(0U)); }
+
+  /**
+   * @brief   Locks the mutex waiting at most the timeout.
+   */
+  bool try_lock_for(delay_t const timeout) {
+    /* Taking an owned mutex again would dead-lock a non recursive mutex. */
+    if ((m_pMutex == nullptr) || m_isOwned) {
+      debug_break;
+      return false;
+    }
+    m_isOwned = m_pMutex->lock(timeout);
+    return m_isOwned;
+  }
+
+  /**
+   * @brief   Unlocks the mutex before the end of the scope.
+   * @return  false if the mutex is not owned.
+   */
+  bool unlock() {
+    if (!m_isOwned) {
+      debug_break;
+      return false;
+    }
+    m_isOwned = false;
+    return m_pMutex->unlock();
+  }
+
+  /**
+   * @brief   Detaches the mutex without unlocking it, the caller becomes
+   * responsible for unlocking an owned mutex.
+   */
+  IMutex *release() {
+    IMutex *const pMutex = m_pMutex;
+    m_pMutex = nullptr;
+    m_isOwned = false;
+    return pMutex;
+  }
+
+  bool owns_lock() const { return m_isOwned; }
+  explicit operator bool() const { return m_isOwned; }
+  IMutex *mutex() const { return m_pMutex; }
+
+private:
+  IMutex *m_pMutex; /**< Mutex guarded, nullptr once moved or released. */
+  bool m_isOwned;   /**< true while this object holds the mutex.        */
+};
+} // namespace RTOS
+#endif // RTOS_SCOPED_LOCK_HPP
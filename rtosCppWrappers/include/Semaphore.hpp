@@ -0,0 +1,108 @@
+/**
+ * @file        Semaphore.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the counting and the binary semaphores.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_SEMAPHORE_HPP
+#define RTOS_SEMAPHORE_HPP
+
+#include "rtos_types.hpp"
+
+namespace RTOS {
+
+using semaphore_handle_t = SemaphoreHandle_t;
+using semaphore_count_t = UBaseType_t;
+
+/**
+ * @brief   Common part of the semaphores.
+ *
+ *          The control block is a member of the object so a semaphore never
+ * touches the RTOS heap or the memory manager. The kernel keeps a pointer to
+ * the control block, so a semaphore can neither be copied nor moved.
+ *
+ *          acquire and release check for an ISR like Mutex::lock, so the same
+ * object signals from an ISR to a thread. From an ISR acquire never waits.
+ */
+class Semaphore {
+public:
+  Semaphore(Semaphore const &) = delete;
+  Semaphore &operator=(Semaphore const &) = delete;
+
+  /**
+   * @brief   Takes the semaphore waiting forever.
+   */
+  bool acquire() { return try_acquire_for(wait_forever); }
+
+  /**
+   * @brief   Takes the semaphore if it is available, without waiting.
+   */
+  bool try_acquire() { return try_acquire_for(delay_t(0U)); }
+
+  /**
+   * @brief   Takes the semaphore waiting at most the timeout.
+   *
+   * @return  true if the semaphore was taken.
+   */
+  bool try_acquire_for(delay_t timeout);
+
+  /**
+   * @brief   Gives the semaphore.
+   *
+   * @return  false if the count is already at its maximum.
+   */
+  bool release();
+
+  /**
+   * @brief   Number of times the semaphore can be taken without waiting.
+   */
+  semaphore_count_t get_count() const;
+
+  bool is_created() const { return m_handle != nullptr; }
+
+protected:
+  Semaphore() : m_semaphoreCB(), m_handle(nullptr) {}
+  ~Semaphore();
+
+  StaticSemaphore_t m_semaphoreCB; /**< Control block of the semaphore. */
+  semaphore_handle_t m_handle;     /**< nullptr if creation failed.     */
+};
+
+/**
+ * @brief   Semaphore counting up to a maximum, for pools of resources and
+ * counting events.
+ */
+class CountingSemaphore : public Semaphore {
+public:
+  explicit CountingSemaphore() = delete;
+
+  /**
+   * @brief   CountingSemaphore constructor.
+   *
+   * @param   max_count Highest count, at least 1.
+   * @param   initial_count Count at the creation, up to max_count.
+   */
+  CountingSemaphore(semaphore_count_t max_count,
+                    semaphore_count_t initial_count = 0U);
+};
+
+/**
+ * @brief   Semaphore that is either available or not, the cheapest signal
+ * from an ISR to a thread.
+ */
+class BinarySemaphore : public Semaphore {
+public:
+  /**
+   * @brief   BinarySemaphore constructor.
+   *
+   * @param   isAvailable true to create the semaphore already given.
+   */
+  explicit BinarySemaphore(bool isAvailable = false);
+};
+} // namespace RTOS
+#endif // RTOS_SEMAPHORE_HPP
@@ -0,0 +1,85 @@
+/**
+ * @file        StackMonitor.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the thread that watches the stack usage of all the
+ * registered threads.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_STACK_MONITOR_HPP
+#define RTOS_STACK_MONITOR_HPP
+
+#include "PeriodicThread.hpp"
+#include "ThreadRegistry.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief   Low priority thread sampling the stack high water mark of every
+ * thread in the ThreadRegistry.
+ *
+ *          The least headroom seen for each thread is recorded. The callback
+ * is raised once for a thread, from the monitor thread, when its headroom
+ * drops below the threshold.
+ */
+class StackMonitor : public PeriodicThread {
+public:
+  /**
+   * @brief   Called when the headroom of a thread drops below the threshold.
+   *
+   * @param   rThread Thread running short of stack.
+   * @param   headroom Free stack of the thread in words.
+   * @param   pContext Context given to the monitor.
+   */
+  using callback_t = void (*)(Thread &rThread, stack_size_t headroom,
+                              void *pContext);
+
+  /**
+   * @brief   StackMonitor constructor.
+   *
+   * @param   period Time between two samples of all the threads.
+   * @param   threshold Headroom in words below which the callback is raised.
+   * @param   pCallback Callback, can be nullptr to only record the headroom.
+   * @param   pContext Passed on to the callback.
+   * @param   priority Priority of the monitor, just above idle by default.
+   * @param   stack_size Stack size of the monitor thread.
+   */
+  StackMonitor(delay_t period, stack_size_t threshold, callback_t pCallback,
+               void *pContext = nullptr,
+               priority_t priority = tskIDLE_PRIORITY + 1U,
+               stack_size_t stack_size = configMINIMAL_STACK_SIZE * 2U);
+
+  /**
+   * @brief   Least headroom recorded for the thread.
+   *
+   * @return  stack_size_t Free words, the stack size of the thread if it was
+   * not sampled yet.
+   */
+  stack_size_t get_min_headroom(Thread const &rThread) const;
+
+  stack_size_t get_threshold() const { return m_threshold; }
+
+protected:
+  void run_period() override;
+
+private:
+  /**
+   * @brief   Monitor state of a registry slot.
+   */
+  struct sample_s {
+    Thread const *pThread;     /**< Thread the sample belongs to.          */
+    stack_size_t min_headroom; /**< Least headroom seen.                   */
+    bool is_reported;          /**< Callback already raised.               */
+  };
+
+  stack_size_t const m_threshold; /**< Headroom raising the callback.      */
+  callback_t const m_pCallback;   /**< Callback for low headroom.          */
+  void *const m_pContext;         /**< Context of the callback.            */
+  sample_s m_samples[ThreadRegistry::MAX_THREADS]; /**< State by slot.     */
+};
+} // namespace RTOS
+#endif // RTOS_STACK_MONITOR_HPP
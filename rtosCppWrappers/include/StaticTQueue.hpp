@@ -0,0 +1,61 @@
+/**
+ * @file        StaticTQueue.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the templated queue with in-object storage.
+ * @version     0.1
+ * @date        2021-07-24
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef STATIC_TQUEUE_RTOS_HPP
+#define STATIC_TQUEUE_RTOS_HPP
+
+#include "TQueue.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief       Holds the item buffer and the control block of a StaticTQueue.
+ *
+ *              This is a base of the StaticTQueue so the storage is in place
+ * before the TQueue base creates the kernel queue over it.
+ *
+ * @tparam T    Type of the queue item.
+ * @tparam N    Number of queue items to hold.
+ */
+template <typename T, size_t N> struct StaticTQueueStorage {
+  alignas(T) uint8_t m_buffer[N * sizeof(T)]; /**< Storage for the items.   */
+  StaticQueue_t m_queueCb; /**< Control block of the queue.                */
+};
+
+/**
+ * @brief       Queue wrapper that never touches the RTOS heap.
+ *
+ *              The items and the control block are members of the object so
+ * the queue footprint is visible in the linker map when placed in static
+ * storage.
+ *
+ * @tparam T    Type of the queue item.
+ * @tparam N    Number of queue items to hold.
+ */
+template <typename T, size_t N>
+class StaticTQueue : private StaticTQueueStorage<T, N>, public TQueue<T, N> {
+  static_assert(N > 0, "RTOS: Queue has to hold at least a single item.");
+
+public:
+  /**
+   * @brief Construct a new StaticTQueue object.
+   */
+  StaticTQueue()
+      : TQueue<T, N>(StaticTQueueStorage<T, N>::m_buffer,
+                     &(StaticTQueueStorage<T, N>::m_queueCb)) {}
+
+  StaticTQueue(StaticTQueue const &) = delete;
+  StaticTQueue &operator=(StaticTQueue const &) = delete;
+
+  ~StaticTQueue() override = default;
+};
+} // namespace RTOS
+#endif // STATIC_TQUEUE_RTOS_HPP
@@ -0,0 +1,67 @@
+/**
+ * @file        StaticThread.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the thread with compile time sized storage.
+ * @version     0.1
+ * @date        2021-07-24
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_STATIC_THREAD_HPP
+#define RTOS_STATIC_THREAD_HPP
+
+#include "Thread.hpp"
+
+namespace RTOS {
+
+/**
+ * @brief       Holds the stack and the TCB of a StaticThread.
+ *
+ *              This is a base of the StaticThread so the storage is in place
+ * before the Thread base starts filling the TCB.
+ *
+ * @tparam StackDepth Number of words in the stack.
+ */
+template <stack_size_t StackDepth> struct StaticThreadStorage {
+  StackType_t m_stack[StackDepth]; /**< Stack of the thread.              */
+  StaticTask_t m_taskCb;           /**< Control block of the thread.      */
+};
+
+/**
+ * @brief       Thread with the stack and the TCB embedded in the object.
+ *
+ *              Creating this thread never touches the MemoryManager. Placing
+ * the object in static storage makes the whole thread footprint visible in the
+ * linker map.
+ *
+ * @tparam StackDepth Number of words in the stack.
+ */
+template <stack_size_t StackDepth>
+class StaticThread : private StaticThreadStorage<StackDepth>, public Thread {
+  static_assert(StackDepth >= configMINIMAL_STACK_SIZE,
+                "RTOS: Stack depth is less than configMINIMAL_STACK_SIZE.");
+
+public:
+  /**
+   * @brief   StaticThread constructor.
+   *
+   * @param   thread_name Name of the thread.
+   * @param   thread_priority Thread priority.
+   * @param   thread_id Requested id, by default 0 lets the ThreadRegistry
+   * assign a free one.
+   */
+  StaticThread(name_t thread_name, priority_t thread_priority,
+               id_t thread_id = 0)
+      : Thread(thread_name, thread_priority, StackDepth,
+               StaticThreadStorage<StackDepth>::m_stack,
+               &(StaticThreadStorage<StackDepth>::m_taskCb), thread_id) {}
+
+  StaticThread(StaticThread const &) = delete;
+  StaticThread &operator=(StaticThread const &) = delete;
+
+  ~StaticThread() override = default;
+};
+} // namespace RTOS
+#endif // RTOS_STATIC_THREAD_HPP
@@ -0,0 +1,230 @@
+/**
+ * @file        StreamBuffer.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the stream and the message buffers for byte I/O.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_STREAM_BUFFER_HPP
+#define RTOS_STREAM_BUFFER_HPP
+
+#include "rtos_types.hpp"
+
+#include "message_buffer.h"
+
+namespace RTOS {
+
+/**
+ * @brief   Bytes owned by the caller, the buffers copy straight to and from
+ * them.
+ */
+struct byte_span_s {
+  uint8_t *pData; /**< First byte.     */
+  size_t size;    /**< Number of bytes. */
+};
+
+struct const_byte_span_s {
+  uint8_t const *pData; /**< First byte.     */
+  size_t size;          /**< Number of bytes. */
+};
+
+/**
+ * @brief   Common part of the stream and the message buffers.
+ *
+ *          A buffer has exactly one writer and one reader, either can be an
+ * ISR. The send and the receive check for an ISR like Mutex::lock, from an ISR
+ * they never wait. Each transfer is a single copy between the caller and the
+ * buffer storage.
+ */
+class ByteBuffer {
+public:
+  ByteBuffer(ByteBuffer const &) = delete;
+  ByteBuffer &operator=(ByteBuffer const &) = delete;
+
+  bool is_created() const { return m_handle != nullptr; }
+  bool is_empty() const;
+  bool is_full() const;
+
+  /**
+   * @brief   Free bytes in the storage.
+   */
+  size_t space() const;
+
+  /**
+   * @brief   Empties the buffer.
+   *
+   * @return  false if a thread is blocked on the buffer.
+   */
+  bool reset();
+
+protected:
+  ByteBuffer(uint8_t *pStorage, size_t size, size_t trigger_level,
+             StaticStreamBuffer_t *pBufferCB, bool isMessageBuffer);
+  ~ByteBuffer();
+
+  size_t send_bytes(void const *pData, size_t size, delay_t timeout);
+  size_t receive_bytes(void *pData, size_t size, delay_t timeout);
+
+  StreamBufferHandle_t m_handle; /**< nullptr if creation failed. */
+};
+
+/**
+ * @brief   Holds the storage and the control block of a buffer.
+ *
+ *          This is a base of the buffers so the storage is in place before the
+ * ByteBuffer base creates the kernel buffer over it. The kernel keeps one byte
+ * of the storage free to tell full from empty, so the buffers hand it all N + 1
+ * bytes and N bytes are usable.
+ *
+ * @tparam N    Number of bytes the buffer holds.
+ */
+template <size_t N> struct ByteBufferStorage {
+  uint8_t m_storage[N + 1U];        /**< Bytes of the buffer.          */
+  StaticStreamBuffer_t m_bufferCB; /**< Control block of the buffer. */
+};
+
+/**
+ * @brief   Buffer of a continuous byte stream, such as a UART.
+ *
+ *          The reader is woken once at least trigger level bytes are in the
+ * buffer, so a reader can collect a burst of bytes with a single wake-up.
+ *
+ * @tparam N    Number of bytes the buffer holds.
+ */
+template <size_t N>
+class StreamBuffer : private ByteBufferStorage<N>, public ByteBuffer {
+  static_assert(N > 0U, "RTOS: Stream buffer has to hold at least a byte.");
+
+public:
+  /**
+   * @brief   StreamBuffer constructor.
+   *
+   * @param   trigger_level Bytes to be in the buffer to wake the reader, from
+   * 1 to N.
+   */
+  explicit StreamBuffer(size_t const trigger_level = 1U)
+      : ByteBuffer(ByteBufferStorage<N>::m_storage, N + 1U, trigger_level,
+                   &(ByteBufferStorage<N>::m_bufferCB), false) {}
+
+  ~StreamBuffer() = default;
+
+  /**
+   * @brief   Writes as many bytes as fit, waiting at most the timeout for the
+   * space.
+   *
+   * @return  size_t Number of bytes written.
+   */
+  size_t send(void const *const pData, size_t const size,
+              delay_t const timeout = delay_t(0U)) {
+    return send_bytes(pData, size, timeout);
+  }
+  size_t send(const_byte_span_s const data,
+              delay_t const timeout = delay_t(0U)) {
+    return send_bytes(data.pData, data.size, timeout);
+  }
+
+  /**
+   * @brief   Reads up to size bytes, waiting at most the timeout for the
+   * trigger level.
+   *
+   * @return  size_t Number of bytes read.
+   */
+  size_t receive(void *const pData, size_t const size, delay_t const timeout) {
+    return receive_bytes(pData, size, timeout);
+  }
+
+  /**
+   * @brief   Reads into the caller bytes.
+   *
+   * @return  byte_span_s Part of the given span that was filled.
+   */
+  byte_span_s receive(byte_span_s const buffer, delay_t const timeout) {
+    return byte_span_s{buffer.pData,
+                       receive_bytes(buffer.pData, buffer.size, timeout)};
+  }
+
+  /**
+   * @brief   Bytes ready to be read.
+   */
+  size_t available() const {
+    return is_created() ? xStreamBufferBytesAvailable(m_handle) : 0U;
+  }
+
+  /**
+   * @brief   Changes the bytes needed to wake the reader, from 1 to N.
+   */
+  bool set_trigger_level(size_t const trigger_level) {
+    return (is_created() && (trigger_level > 0U) && (trigger_level <= N)) &&
+           (xStreamBufferSetTriggerLevel(m_handle, trigger_level) == pdTRUE);
+  }
+};
+
+/**
+ * @brief   Buffer of variable length messages, such as log records.
+ *
+ *          A message is written and read as a whole. Each message takes
+ * MESSAGE_OVERHEAD bytes of the storage for its length.
+ *
+ * @tparam N    Number of bytes the buffer holds, lengths included.
+ */
+template <size_t N>
+class MessageBuffer : private ByteBufferStorage<N>, public ByteBuffer {
+public:
+  static constexpr size_t MESSAGE_OVERHEAD = sizeof(size_t);
+
+  static_assert(N > MESSAGE_OVERHEAD,
+                "RTOS: Message buffer has to hold at least a message.");
+
+  MessageBuffer()
+      : ByteBuffer(ByteBufferStorage<N>::m_storage, N + 1U, 0U,
+                   &(ByteBufferStorage<N>::m_bufferCB), true) {}
+
+  ~MessageBuffer() = default;
+
+  /**
+   * @brief   Writes the message, waiting at most the timeout for the space.
+   *
+   * @return  true if the whole message was written.
+   */
+  bool send(void const *const pData, size_t const size,
+            delay_t const timeout = delay_t(0U)) {
+    return (size > 0U) && (send_bytes(pData, size, timeout) == size);
+  }
+  bool send(const_byte_span_s const message,
+            delay_t const timeout = delay_t(0U)) {
+    return send(message.pData, message.size, timeout);
+  }
+
+  /**
+   * @brief   Reads the next message, waiting at most the timeout for one.
+   *
+   * @return  size_t Length of the message, 0 if there was none or it does not
+   * fit in size bytes. A message that does not fit stays in the buffer.
+   */
+  size_t receive(void *const pData, size_t const size, delay_t const timeout) {
+    return receive_bytes(pData, size, timeout);
+  }
+
+  /**
+   * @brief   Reads the next message into the caller bytes.
+   *
+   * @return  byte_span_s The message within the given span, empty if none.
+   */
+  byte_span_s receive(byte_span_s const buffer, delay_t const timeout) {
+    return byte_span_s{buffer.pData,
+                       receive_bytes(buffer.pData, buffer.size, timeout)};
+  }
+
+  /**
+   * @brief   Length of the next message, 0 if the buffer is empty.
+   */
+  size_t next_size() const {
+    return is_created() ? xMessageBufferNextLengthBytes(m_handle) : 0U;
+  }
+};
+} // namespace RTOS
+#endif // RTOS_STREAM_BUFFER_HPP
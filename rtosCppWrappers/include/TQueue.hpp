@@ -16,6 +16,11 @@
 #include "IQueueSender.hpp"
 
 #include "MemoryManager.hpp"
+#include "QueueBatch.hpp"
+
+#include <new>
+#include <optional>
+#include <type_traits>
 
 namespace RTOS {
 
@@ -27,18 +32,45 @@ namespace RTOS {
  */
 template <typename T, size_t N>
 class TQueue : public IQueueSender, public IQueueReceiver {
+  /* The kernel moves the items with memcpy. */
+  static_assert(std::is_trivially_copyable_v<T>,
+                "RTOS: Queue items have to be trivially copyable.");
 
   /*---------------------- Non-static data members -------------------------*/
   que_handle_t m_pHandle; /**< Holds the pointer to the queue handle */
   queue_cb_t
       m_pQueueCB; /**< Holds pointer buffer for the queue control block     */
   T *m_pBuffer;   /**< Holds pointer buffer for the entire queue            */
+  bool m_isStorageOwned; /**< True if buffer and CB are from MemoryManager.  */
+
+protected:
+  /**
+   * @brief Construct a new Queue object over caller provided storage.
+   *
+   *        No memory is requested from the MemoryManager. Used by the
+   * StaticTQueue template.
+   *
+   * @param pBuffer Buffer that can hold N items of type T.
+   * @param pQueueCB Control block of the queue.
+   */
+  TQueue(uint8_t *const pBuffer, queue_cb_t const pQueueCB)
+      : m_pHandle(nullptr), m_pQueueCB(pQueueCB),
+        m_pBuffer(reinterpret_cast<T *>(pBuffer)), m_isStorageOwned(false) {
+    m_pHandle = xQueueCreateStatic(N, sizeof(T), pBuffer, m_pQueueCB);
+
+    /* The kernel refused the storage e.g. a null buffer or control block. */
+    if (m_pHandle == nullptr) {
+      debug_break;
+    }
+  }
 
 public:
   /**
    * @brief Construct a new Queue object.
    */
-  TQueue() : m_pHandle(nullptr), m_pQueueCB(nullptr), m_pBuffer(nullptr) {
+  TQueue()
+      : m_pHandle(nullptr), m_pQueueCB(nullptr), m_pBuffer(nullptr),
+        m_isStorageOwned(true) {
     /* Try and successfully get the control block for queue. */
     bool isSuccessful = MemoryManager::get_Instance().get_CB(&m_pQueueCB) ==
                         eMemAllocationSuccess;
@@ -65,8 +97,10 @@ public:
   /* destructor */
   ~TQueue() override {
     vQueueDelete(m_pHandle);
-    MemoryManager::release_CB(m_pQueueCB);
-    MemoryManager::release_block(m_pBuffer);
+    if (m_isStorageOwned) {
+      MemoryManager::release_CB(m_pQueueCB);
+      MemoryManager::release_block(m_pBuffer);
+    }
   }
 
   /*-------------------------- Inherited methods ---------------------------*/
@@ -77,7 +111,7 @@ public:
     if (xPortIsInsideInterrupt() == pdTRUE) {
 
       /* Check if the api call can be made with no blocking. */
-      if (wait_time == 0.0f) {
+      if (wait_time.ticks() == 0U) {
         base_t isYieldRequired = 0U;
         ret_val = xQueueSendToFrontFromISR(m_pHandle, pv_item_to_queue,
                                            &isYieldRequired);
@@ -97,7 +131,7 @@ public:
     /* Call is not from an ISR use non ISR flavour. */
     else {
       ret_val = xQueueSendToFront(m_pHandle, pv_item_to_queue,
-                                  pdMS_TO_TICKS(wait_time));
+                                  wait_time.ticks());
     }
     return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess
                              : RET_STA_E::eRTOSFailure;
@@ -114,7 +148,7 @@ public:
     if (xPortIsInsideInterrupt() == pdTRUE) {
 
       /* Check if the api call can be made with no blocking. */
-      if (wait_time == 0.0f) {
+      if (wait_time.ticks() == 0U) {
         base_t isYieldRequired = 0U;
         ret_val = xQueueSendToBackFromISR(m_pHandle, pv_item_to_queue,
                                           &isYieldRequired);
@@ -134,7 +168,7 @@ public:
     /* Call is not from an ISR use non ISR flavour. */
     else {
       ret_val = xQueueSendToBack(m_pHandle, pv_item_to_queue,
-                                 pdMS_TO_TICKS(wait_time));
+                                 wait_time.ticks());
     }
     return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess
                              : RET_STA_E::eRTOSFailure;
@@ -150,7 +184,7 @@ public:
     if (xPortIsInsideInterrupt() == pdTRUE) {
 
       /* Check if the api call can be made with no blocking. */
-      if (wait_time == 0.0f) {
+      if (wait_time.ticks() == 0U) {
         base_t isYieldRequired = 0U;
         ret_val = xQueueReceiveFromISR(m_pHandle, pv_buffer, &isYieldRequired);
         /* Check if a context switch is required. */
@@ -168,7 +202,7 @@ public:
 
     /* Call is not from an ISR use non ISR flavour. */
     else {
-      ret_val = xQueueReceive(m_pHandle, pv_buffer, pdMS_TO_TICKS(wait_time));
+      ret_val = xQueueReceive(m_pHandle, pv_buffer, wait_time.ticks());
     }
 
     return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess
@@ -176,7 +210,7 @@ public:
   }
 
   void dequeue(void *const pv_buffer) override {
-    (void)dequeue(pv_buffer, pdMS_TO_TICKS(wait_forever));
+    (void)dequeue(pv_buffer, wait_forever);
   }
 
   RET_STA_E peek(void *const pv_buffer, delay_t wait_time) override {
@@ -186,7 +220,7 @@ public:
     if (xPortIsInsideInterrupt() == pdTRUE) {
 
       /* Check if the api call can be made with no blocking. */
-      if (wait_time == 0.0f) {
+      if (wait_time.ticks() == 0U) {
         ret_val = xQueuePeekFromISR(m_pHandle, pv_buffer);
       } else {
         /* Cannot post to a queue with a blocking time from an ISR. */
@@ -196,7 +230,7 @@ public:
 
     /* Call is not from an ISR use non ISR flavour. */
     else {
-      ret_val = xQueuePeek(m_pHandle, pv_buffer, pdMS_TO_TICKS(wait_time));
+      ret_val = xQueuePeek(m_pHandle, pv_buffer, wait_time.ticks());
     }
 
     return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess
@@ -204,7 +238,172 @@ public:
   }
 
   void peek(void *const buffer) override {
-    (void)peek(buffer, pdMS_TO_TICKS(wait_forever));
+    (void)peek(buffer, wait_forever);
+  }
+
+  size_t enqueue_n(const void *const pv_items, size_t const item_count,
+                   delay_t const wait_time) override {
+    return queue_send_n(m_pHandle, static_cast<const uint8_t *>(pv_items),
+                        sizeof(T), item_count, wait_time);
+  }
+
+  size_t dequeue_n(void *const pv_buffer, size_t const item_count,
+                   delay_t const wait_time) override {
+    return queue_receive_n(m_pHandle, static_cast<uint8_t *>(pv_buffer),
+                           sizeof(T), item_count, wait_time);
+  }
+
+  /*---------------------------- Typed methods -----------------------------*/
+  /* Note: These call the untyped methods non-virtually so the calls can be
+   * inlined, the item size is fixed by T at compile time. */
+
+  /**
+   * @brief   Places the item at the front of the queue.
+   *
+   * @param   item Item to be queued.
+   * @param   wait_time Time to wait for space on the queue.
+   * @return  RET_STA_E eRTOSSuccess if the item is queued before the time-out.
+   */
+  RET_STA_E enqueue_to_front(const T &item, delay_t wait_time) {
+    return TQueue::enqueue_to_front(static_cast<const void *>(&item),
+                                    wait_time);
+  }
+
+  /**
+   * @brief   Places the item at the front of the queue, waits forever.
+   *
+   * @param   item Item to be queued.
+   */
+  void enqueue_to_front(const T &item) {
+    (void)TQueue::enqueue_to_front(static_cast<const void *>(&item),
+                                   wait_forever);
+  }
+
+  /**
+   * @brief   Places the item at the back of the queue.
+   *
+   * @param   item Item to be queued.
+   * @param   wait_time Time to wait for space on the queue.
+   * @return  RET_STA_E eRTOSSuccess if the item is queued before the time-out.
+   */
+  RET_STA_E enqueue(const T &item, delay_t wait_time) {
+    return TQueue::enqueue(static_cast<const void *>(&item), wait_time);
+  }
+
+  /**
+   * @brief   Places the item at the back of the queue, waits forever.
+   *
+   * @param   item Item to be queued.
+   */
+  void enqueue(const T &item) {
+    (void)TQueue::enqueue(static_cast<const void *>(&item), wait_forever);
+  }
+
+  /**
+   * @brief   Receives an item from the queue.
+   *
+   * @param   item [out] Holds the received item.
+   * @param   wait_time Time to wait for an item on the queue.
+   * @return  RET_STA_E eRTOSSuccess if an item is received before the time-out.
+   */
+  RET_STA_E dequeue(T &item, delay_t wait_time) {
+    return TQueue::dequeue(static_cast<void *>(&item), wait_time);
+  }
+
+  /**
+   * @brief   Receives an item from the queue, waits forever.
+   *
+   * @param   item [out] Holds the received item.
+   */
+  void dequeue(T &item) {
+    (void)TQueue::dequeue(static_cast<void *>(&item), wait_forever);
+  }
+
+  /**
+   * @brief   Receives an item from the queue.
+   *
+   *          The item is received into raw storage, so T does not have to be
+   * default constructible.
+   *
+   * @param   wait_time Time to wait for an item on the queue.
+   * @return  std::optional<T> Holds the item. Empty if nothing is received
+   * before the time-out, an ISR never waits.
+   */
+  std::optional<T> dequeue(delay_t wait_time) {
+    alignas(T) uint8_t storage[sizeof(T)];
+    if (TQueue::dequeue(static_cast<void *>(storage), wait_time) ==
+        RET_STA_E::eRTOSSuccess) {
+      /* T is trivially copyable, the copied bytes are the item. */
+      return *std::launder(reinterpret_cast<T *>(storage));
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief   Receives an item from the queue if one is available. Never
+   * blocks.
+   *
+   * @param   item [out] Holds the received item.
+   * @return  true if an item is received else false.
+   */
+  bool try_dequeue(T &item) {
+    return dequeue(item, delay_t(0U)) == RET_STA_E::eRTOSSuccess;
+  }
+
+  /**
+   * @brief   Receives an item from the queue if one is available. Never
+   * blocks.
+   *
+   * @return  std::optional<T> Holds the item. Empty if the queue is empty.
+   */
+  std::optional<T> try_dequeue() { return dequeue(delay_t(0U)); }
+
+  /**
+   * @brief   Copies the item at the front without removing it.
+   *
+   * @param   item [out] Holds the copied item.
+   * @param   wait_time Time to wait for an item on the queue.
+   * @return  RET_STA_E eRTOSSuccess if an item is copied before the time-out.
+   */
+  RET_STA_E peek(T &item, delay_t wait_time) {
+    return TQueue::peek(static_cast<void *>(&item), wait_time);
+  }
+
+  /**
+   * @brief   Copies the item at the front without removing it, waits forever.
+   *
+   * @param   item [out] Holds the copied item.
+   */
+  void peek(T &item) {
+    (void)TQueue::peek(static_cast<void *>(&item), wait_forever);
+  }
+
+  /**
+   * @brief   Places up to item_count items at the back of the queue.
+   *
+   * @param   pItems Items to be queued.
+   * @param   item_count Number of items in pItems.
+   * @param   wait_time Time to wait for space for the first item.
+   * @return  size_t Number of items queued.
+   */
+  size_t enqueue_n(const T *const pItems, size_t const item_count,
+                   delay_t const wait_time) {
+    return TQueue::enqueue_n(static_cast<const void *>(pItems), item_count,
+                             wait_time);
+  }
+
+  /**
+   * @brief   Receives up to item_count items from the queue.
+   *
+   * @param   pItems [out] Buffer for item_count items.
+   * @param   item_count Maximum number of items to receive.
+   * @param   wait_time Time to wait for the first item.
+   * @return  size_t Number of items received.
+   */
+  size_t dequeue_n(T *const pItems, size_t const item_count,
+                   delay_t const wait_time) {
+    return TQueue::dequeue_n(static_cast<void *>(pItems), item_count,
+                             wait_time);
   }
 };
 } // namespace RTOS
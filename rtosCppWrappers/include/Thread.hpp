@@ -13,6 +13,7 @@
 
 #include "ISignal.hpp"
 #include "IThread.hpp"
+#include "RuntimeStats.hpp"
 
 namespace RTOS {
 
@@ -59,13 +60,35 @@ public:
    * @param   thread_name Name of the thread.
    * @param   thread_priority Thread priority.
    * @param   thread_stack_size Thread stack size.
-   * @param   thread_id Thread id by default will be 0.
+   * @param   thread_id Requested id, by default 0 lets the ThreadRegistry
+   * assign a free one.
    */
   Thread(name_t thread_name, /**<Single constructor for the thread class. */
          priority_t thread_priority, stack_size_t thread_stack_size,
          id_t thread_id = 0);
 
   ~Thread() override;
+protected:
+  /**
+   * @brief   Thread constructor over caller provided storage.
+   *
+   *          No memory is requested from the MemoryManager. The stack and the
+   * TCB are owned by the caller and have to out-live the thread object. Used
+   * by the StaticThread template.
+   *
+   * @param   thread_name Name of the thread.
+   * @param   thread_priority Thread priority.
+   * @param   thread_stack_size Number of words in the stack.
+   * @param   stack Stack buffer of thread_stack_size words.
+   * @param   task_cb Control block of the task.
+   * @param   thread_id Requested id, by default 0 lets the ThreadRegistry
+   * assign a free one.
+   */
+  Thread(name_t thread_name, priority_t thread_priority,
+         stack_size_t thread_stack_size, stack_t stack,
+         control_block_t task_cb, id_t thread_id = 0);
+
+public:
   /*------------------ Static Methods -------------------*/
   /**
    * @brief   Starts the freeRTOS scheduler if not running.
@@ -83,6 +106,12 @@ public:
    */
   static bool is_scheduler_running();
 
+  /**
+   * @brief   Used to identify if the scheduler was ended by end_scheduler().
+   * @return  True once the scheduler has been ended, it never runs again.
+   */
+  static bool is_scheduler_ended();
+
   /**
    * @brief   Make's a mask with the specified bit set.
    *
@@ -104,6 +133,26 @@ public:
   // This is a simple default implementation inheriting class have to override.
   RET_STA_E thread_delete() override;
 
+  /**
+   * @brief   CPU usage of the thread since the scheduler started.
+   *
+   * @return  runtime_stats_s All zero if the thread is not created yet.
+   */
+  runtime_stats_s get_runtime_stats() const;
+
+  /**
+   * @brief   Size of the thread stack in words.
+   */
+  stack_size_t get_stack_size() const;
+
+  /**
+   * @brief   Least free stack the thread had since it started i.e. the stack
+   * high water mark.
+   *
+   * @return  stack_size_t Free words, 0 if the thread is not created yet.
+   */
+  stack_size_t get_stack_headroom() const;
+
   /*---- Methods inhereted from the ISignal interface ----*/
   void signal_on_bits(uint32_t bitsToSet) override;
   void send_value_with_over_write(uint32_t valueToSend) override;
@@ -117,10 +166,23 @@ public:
   /**
    * @brief   Calling this function will move the thread to blocked state for a
    *          given amount of time.
-   * @param   delay This should be a non-negative value describing the number of
-   * milli-seconds the thread has to be in blocked state before being resumed.
+   * @param   delay Time the thread has to be in blocked state before being
+   * resumed. A plain integer is taken as milli-seconds, a std::chrono duration
+   * or a tick count (5_ticks) can be passed as well.
    */
   static void delay_ms(delay_t delay);
+  /**
+   * @brief   Blocks the thread until a period has passed since the last wake
+   * time. Unlike delay_ms the execution time of the thread does not add up, so
+   * a periodic thread does not drift.
+   *
+   * @param   rLastWakeTime Tick count of the last wake-up. Initialise it once
+   * with xTaskGetTickCount(), it is advanced by period on every call.
+   * @param   period        Period of the thread.
+   * @return  true if the thread was blocked, false if the next wake time had
+   * already passed i.e. the thread over-ran its period.
+   */
+  static bool delay_until(TickType_t &rLastWakeTime, delay_t period);
   /**
    * @brief   Call to this member paces the thread in blocked state till the
    * thread is notified by some other task or the time-out expires.
@@ -198,14 +260,20 @@ private:
    */
   static void start(void *);
 
-  static id_t m_sThreadCount; /**<Holds the count of the threads that have been
-                                 created*/
+  /**
+   * @brief   Fills the TCB with the creation arguments and assigns the id.
+   */
+  void prepare(name_t thread_name, priority_t thread_priority,
+               stack_size_t thread_stack_size, id_t thread_id);
+
   /*---------------- Non Static member variables -------------*/
   status_e m_threadStatus; /**<Hold the status of the thread. */
   id_t m_threadId;         /**<Holds the id of the current thread.*/
   thr_handle_t m_pHandle; /**<Points to the task handle of the created thread.*/
   stack_t m_pStack;       /**<Points to the stack of the thread created.*/
   control_block_t m_pTaskCb; /**<Points to the task's control block.*/
+  stack_size_t m_stackSize;  /**<Number of words in the stack.*/
+  bool m_isStorageOwned; /**<True if stack and TCB are from the MemoryManager.*/
 };
 } // namespace RTOS
 #endif // RTOS_THREAD_HPP
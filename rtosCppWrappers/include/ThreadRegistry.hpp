@@ -0,0 +1,171 @@
+/**
+ * @file        ThreadRegistry.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the registry that keeps track of all the threads.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_THREAD_REGISTRY_HPP
+#define RTOS_THREAD_REGISTRY_HPP
+
+#include "rtos_types.hpp"
+
+#include <limits>
+
+/* Most threads that can be registered at once, see threadConfiguration.cmake */
+#ifndef RTOS_MAX_THREADS
+#define RTOS_MAX_THREADS 16
+#endif
+
+namespace RTOS {
+
+class Thread;
+
+/**
+ * @brief   Smallest power of two not below the value.
+ */
+constexpr size_t power_of_two_above(size_t const value) {
+  size_t power = 1U;
+  while (power < value) {
+    power <<= 1U;
+  }
+  return power;
+}
+
+/**
+ * @brief   Entry of a registered thread.
+ */
+struct thread_entry_s {
+  Thread *pThread;                    /**< Registered thread.              */
+  thr_handle_t handle;                /**< nullptr until the thread joins. */
+  priority_t priority;                /**< Base priority of the thread.    */
+  char name[configMAX_TASK_NAME_LEN]; /**< Name, truncated like the kernel. */
+};
+
+/**
+ * @brief   Singleton holding every constructed Thread in a fixed table.
+ *
+ *          The threads add and remove themselves on construction and
+ * destruction, so dispatchers and diagnostics can address the threads with
+ * out walking the kernel lists.
+ *
+ *          The id of a thread is its slot in the table plus one, so a lookup
+ * by id is an index. The names are hashed into buckets chained through the
+ * table. The ids of the removed threads are handed out again. The table is
+ * constant initialised, so threads with static storage are registered safely.
+ */
+class ThreadRegistry {
+public:
+  static constexpr size_t MAX_THREADS = RTOS_MAX_THREADS;
+  static constexpr id_t INVALID_ID = 0U; /**< Id of an unregistered thread. */
+
+  static_assert((MAX_THREADS > 0U) &&
+                    (MAX_THREADS < std::numeric_limits<id_t>::max()),
+                "RTOS: The registry size has to fit in the thread id type!!");
+
+  static ThreadRegistry &get_Instance();
+
+  ThreadRegistry(ThreadRegistry const &) = delete;
+  ThreadRegistry &operator=(ThreadRegistry const &) = delete;
+
+  /**
+   * @brief   Registers the thread and assigns its id.
+   *
+   * @param   rThread Thread to be registered.
+   * @param   name Name of the thread.
+   * @param   priority Priority of the thread.
+   * @param   requested_id Id the thread wants, INVALID_ID for any. A taken or
+   * out of range id is replaced by a free one.
+   * @return  id_t Id of the thread, INVALID_ID if the table is full.
+   */
+  id_t add(Thread &rThread, name_t name, priority_t priority,
+           id_t requested_id = INVALID_ID);
+
+  /**
+   * @brief   Removes the thread, its id can be handed out again.
+   */
+  void remove(id_t id);
+
+  /**
+   * @brief   Records the handle once the thread is created in the kernel.
+   */
+  void set_handle(id_t id, thr_handle_t handle);
+
+  /**
+   * @brief   Records a new base priority of the thread.
+   */
+  void set_priority(id_t id, priority_t priority);
+
+  /**
+   * @brief   Thread with the given id in O(1).
+   *
+   * @return  Thread* nullptr if no thread has the id.
+   */
+  Thread *find(id_t id) const;
+
+  /**
+   * @brief   Thread with the given name through the name hash.
+   *
+   * @return  Thread* Latest registered thread with the name, nullptr if none.
+   */
+  Thread *find(name_t name) const;
+
+  /**
+   * @brief   Copies the entry of the thread with the given id.
+   *
+   *          The copy keeps the name even if the thread goes away and its id
+   * is handed out again.
+   *
+   * @return  true if a thread has the id.
+   */
+  bool get_entry(id_t id, thread_entry_s &rEntry) const;
+
+  /**
+   * @brief   Thread in the given slot, the slot of id is id - 1.
+   *
+   * @param   slot Any slot below MAX_THREADS.
+   * @return  Thread* nullptr if the slot is free. Suspend the scheduler while
+   * using the thread if it can be destroyed by another thread.
+   */
+  Thread *at(size_t slot) const;
+
+  /**
+   * @brief   Number of registered threads.
+   */
+  size_t count() const;
+
+private:
+  /* Power of two number of name buckets, about one per thread. */
+  static constexpr size_t NAME_BUCKETS = power_of_two_above(MAX_THREADS);
+
+  constexpr ThreadRegistry()
+      : m_entries(), m_nextId(), m_bucketHead(), m_freeHead(INVALID_ID),
+        m_usedIdCount(0U), m_threadCount(0U) {}
+
+  /**
+   * @brief   FNV-1a hash of the name as stored in the entry.
+   */
+  static uint32_t hash_name(name_t name);
+  static bool is_same_name(char const *pStored, name_t name);
+
+  /* Following functions expect the caller to hold the critical section. */
+  Thread *thread_of(id_t id) const;
+  id_t take_id(id_t requested_id);
+  void unlink_name(id_t id);
+
+  static ThreadRegistry m_rThreadRegistry;
+
+  thread_entry_s m_entries[MAX_THREADS]; /**< Entry of each id, by slot.   */
+  /** Next id in the same name bucket or the free list, INVALID_ID ends. */
+  id_t m_nextId[MAX_THREADS];
+  id_t m_bucketHead[NAME_BUCKETS]; /**< First id of each name bucket.      */
+  id_t m_freeHead;                 /**< Last released id.                  */
+  size_t m_usedIdCount;            /**< Ids up to this were handed out.    */
+  size_t m_threadCount;            /**< Number of registered threads.      */
+};
+} // namespace RTOS
+#endif // RTOS_THREAD_REGISTRY_HPP
@@ -0,0 +1,140 @@
+/**
+ * @file        Timer.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the software timer run by the timer daemon.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_TIMER_HPP
+#define RTOS_TIMER_HPP
+
+#include "rtos_types.hpp"
+
+#if configUSE_TIMERS != 1
+#error "RTOS: Timer needs configUSE_TIMERS set to 1!!"
+#endif
+
+namespace RTOS {
+
+/**
+ * @brief   Whether the timer runs once or again every period.
+ */
+enum class timer_mode_e : uint8_t {
+  eOneShot,    /**< Expires once per start.        */
+  eAutoReload, /**< Expires every period till stop. */
+};
+
+/**
+ * @brief   Software timer that runs its expiry in the timer daemon thread.
+ *
+ *          All the timers share the stack of the daemon, so short periodic
+ * jobs do not need a thread each. The expiry runs at the daemon priority and
+ * must not block.
+ *
+ *          The expiry is either the callback given to the constructor or an
+ * override of on_expiry(). The control block is a member of the object, so a
+ * timer can neither be copied nor moved. A class overriding on_expiry() calls
+ * release() in its own destructor, else the expiry can run while the class is
+ * torn down.
+ *
+ *          A timer must not be destroyed in the daemon thread, i.e. from any
+ * expiry or pended function, nor before the scheduler runs. The kernel deletes
+ * a timer by a command that the daemon runs later, after the object would be
+ * gone, so release() refuses these with a debug break. Destroying it after
+ * end_scheduler() is fine.
+ *
+ *          The commands are posted to the daemon. They check for an ISR like
+ * Mutex::lock, the timeout is how long a thread waits for space in the command
+ * queue and is ignored in an ISR.
+ */
+class Timer {
+public:
+  using callback_t = void (*)(Timer &rTimer, void *pContext);
+
+  explicit Timer() = delete;
+
+  /**
+   * @brief   Timer constructor. The timer is created dormant.
+   *
+   * @param   timer_name Name of the timer, for the debugger.
+   * @param   period Time from the start to the expiry, at least a tick.
+   * @param   mode One shot or auto reload.
+   * @param   callback Called on expiry in the daemon thread.
+   * @param   pContext Passed to the callback.
+   */
+  Timer(name_t timer_name, delay_t period, timer_mode_e mode,
+        callback_t callback, void *pContext = nullptr);
+
+  /**
+   * @brief   Releases the timer, see release().
+   */
+  virtual ~Timer();
+
+  Timer(Timer const &) = delete;
+  Timer &operator=(Timer const &) = delete;
+
+  /**
+   * @brief   Starts the timer, a running timer is restarted.
+   */
+  bool start(delay_t timeout = delay_t(0U));
+
+  /**
+   * @brief   Stops the timer, the expiry is not called.
+   */
+  bool stop(delay_t timeout = delay_t(0U));
+
+  /**
+   * @brief   Restarts the period from now, starting a dormant timer.
+   */
+  bool reset(delay_t timeout = delay_t(0U));
+
+  /**
+   * @brief   Changes the period, starting a dormant timer.
+   *
+   * @param   period New period, at least a tick.
+   */
+  bool change_period(delay_t period, delay_t timeout = delay_t(0U));
+
+  /**
+   * @brief   true if the timer is waiting to expire.
+   */
+  bool is_active() const;
+
+  delay_t get_period() const;
+
+protected:
+  /**
+   * @brief   Timer for the inheriting classes that override on_expiry().
+   */
+  Timer(name_t timer_name, delay_t period, timer_mode_e mode);
+
+  /**
+   * @brief   Called on expiry in the daemon thread. Calls the callback by
+   * default.
+   */
+  virtual void on_expiry();
+
+  /**
+   * @brief   Deletes the timer and waits for the daemon to let go of it, after
+   * this the expiry is never called. The destructor does it if it was not done
+   * before.
+   *
+   *          Called from a thread while the scheduler runs. In the daemon or
+   * before the scheduler runs it breaks and keeps the timer, see Timer.
+   */
+  void release();
+
+private:
+  static void expiry_callback(TimerHandle_t handle);
+
+  StaticTimer_t m_timerCB; /**< Control block of the timer.  */
+  TimerHandle_t m_handle;  /**< nullptr if creation failed.  */
+  callback_t m_callback;   /**< Expiry, nullptr if overridden. */
+  void *m_pContext;        /**< Context of the callback.     */
+};
+} // namespace RTOS
+#endif // RTOS_TIMER_HPP
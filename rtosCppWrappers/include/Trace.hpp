@@ -0,0 +1,249 @@
+/**
+ * @file        Trace.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Application instrumentation recorded next to the kernel events
+ * in SystemView.
+ * @version     0.1
+ * @date        2021-08-01
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_TRACE_HPP
+#define RTOS_TRACE_HPP
+
+#include "rtos_types.hpp"
+
+#if SYSTEM_VIEW_ANALYSIS == 1
+#include "SEGGER_SYSVIEW.h"
+#endif
+
+namespace RTOS {
+
+/**
+ * @brief   Markers, user events and values of the application in SystemView.
+ *
+ *          Everything here is inline and compiles to nothing when
+ * SYSTEM_VIEW_ANALYSIS is 0, so the instrumentation can stay in the hot paths
+ * of a release build.
+ */
+namespace Trace {
+
+using marker_id_t = uint32_t;
+using event_id_t = uint32_t;
+
+#if SYSTEM_VIEW_ANALYSIS == 1
+constexpr bool IS_ENABLED = true;
+#else
+constexpr bool IS_ENABLED = false;
+#endif
+
+/**
+ * @brief   Name shown for the marker, send once after the scheduler started.
+ */
+inline void name_marker(marker_id_t const id, char const *const pName) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_NameMarker(id, pName);
+#else
+  (void)id;
+  (void)pName;
+#endif
+}
+
+/**
+ * @brief   Start of the span of the marker.
+ */
+inline void mark_start(marker_id_t const id) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_MarkStart(id);
+#else
+  (void)id;
+#endif
+}
+
+/**
+ * @brief   End of the span of the marker.
+ */
+inline void mark_stop(marker_id_t const id) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_MarkStop(id);
+#else
+  (void)id;
+#endif
+}
+
+/**
+ * @brief   A point in the span of the marker.
+ */
+inline void mark(marker_id_t const id) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_Mark(id);
+#else
+  (void)id;
+#endif
+}
+
+/**
+ * @brief   Text messages in the terminal of SystemView.
+ */
+inline void print(char const *const pText) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_Print(pText);
+#else
+  (void)pText;
+#endif
+}
+
+inline void warn(char const *const pText) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_Warn(pText);
+#else
+  (void)pText;
+#endif
+}
+
+inline void error(char const *const pText) {
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_Error(pText);
+#else
+  (void)pText;
+#endif
+}
+
+/**
+ * @brief   Marks the span from the construction to the end of the scope.
+ */
+class ScopedMarker {
+public:
+  explicit ScopedMarker(marker_id_t const id)
+#if SYSTEM_VIEW_ANALYSIS == 1
+      : m_id(id)
+#endif
+  {
+    mark_start(id);
+  }
+
+  ~ScopedMarker() {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    mark_stop(m_id);
+#endif
+  }
+
+  ScopedMarker(ScopedMarker const &) = delete;
+  ScopedMarker &operator=(ScopedMarker const &) = delete;
+
+#if SYSTEM_VIEW_ANALYSIS == 1
+private:
+  marker_id_t const m_id;
+#endif
+};
+
+/**
+ * @brief   Module of named user events.
+ *
+ *          The description names the module and its events in the format of
+ * SystemView, for example "M=Radio, 0 Tx len=%u, 1 Rx len=%u". The events are
+ * numbered from 0 within the module and SystemView gives the module its
+ * offset on registration. A module has to have static storage and is
+ * registered once, after the scheduler started.
+ */
+class Module {
+public:
+  constexpr Module(char const *const pDescription, uint32_t const event_count)
+#if SYSTEM_VIEW_ANALYSIS == 1
+      : m_module{pDescription, event_count, 0U, nullptr, nullptr}
+#endif
+  {
+    (void)pDescription;
+    (void)event_count;
+  }
+
+  Module(Module const &) = delete;
+  Module &operator=(Module const &) = delete;
+
+  void register_module() {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    SEGGER_SYSVIEW_RegisterModule(&m_module);
+#endif
+  }
+
+  /**
+   * @brief   Records the event with up to two values.
+   */
+  void record(event_id_t const event) const {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    if (event < m_module.NumEvents) {
+      SEGGER_SYSVIEW_RecordVoid(m_module.EventOffset + event);
+    }
+#else
+    (void)event;
+#endif
+  }
+
+  void record(event_id_t const event, uint32_t const value) const {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    if (event < m_module.NumEvents) {
+      SEGGER_SYSVIEW_RecordU32(m_module.EventOffset + event, value);
+    }
+#else
+    (void)event;
+    (void)value;
+#endif
+  }
+
+  void record(event_id_t const event, uint32_t const first,
+              uint32_t const second) const {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    if (event < m_module.NumEvents) {
+      SEGGER_SYSVIEW_RecordU32x2(m_module.EventOffset + event, first, second);
+    }
+#else
+    (void)event;
+    (void)first;
+    (void)second;
+#endif
+  }
+
+  /**
+   * @brief   Ends the call started by record(event), SystemView shows the
+   * duration of the call.
+   */
+  void record_end(event_id_t const event) const {
+#if SYSTEM_VIEW_ANALYSIS == 1
+    if (event < m_module.NumEvents) {
+      SEGGER_SYSVIEW_RecordEndCall(m_module.EventOffset + event);
+    }
+#else
+    (void)event;
+#endif
+  }
+
+private:
+#if SYSTEM_VIEW_ANALYSIS == 1
+  SEGGER_SYSVIEW_MODULE m_module;
+#endif
+};
+
+/**
+ * @brief   Numeric value sampled over time, such as a queue depth.
+ *
+ *          The vendored SystemView has no data plot API, so each sample is an
+ * event of a single event module with the value as its parameter. The
+ * description names the value, for example "M=QueueDepth, 0 depth=%u".
+ */
+class ValuePlot {
+public:
+  explicit constexpr ValuePlot(char const *const pDescription)
+      : m_module(pDescription, 1U) {}
+
+  void register_plot() { m_module.register_module(); }
+
+  void sample(uint32_t const value) const { m_module.record(0U, value); }
+
+private:
+  Module m_module;
+};
+} // namespace Trace
+} // namespace RTOS
+#endif // RTOS_TRACE_HPP
@@ -0,0 +1,294 @@
+/**
+ * @file        WorkQueue.hpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the executor that runs short jobs on a few shared
+ * worker threads.
+ * @version     0.1
+ * @date        2021-08-03
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#ifndef RTOS_WORK_QUEUE_HPP
+#define RTOS_WORK_QUEUE_HPP
+
+#include "Semaphore.hpp"
+#include "StaticTQueue.hpp"
+#include "StaticThread.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/* Bytes a job keeps its callable in, see workQueueConfiguration.cmake */
+#ifndef RTOS_JOB_STORAGE_SIZE
+#define RTOS_JOB_STORAGE_SIZE 16
+#endif
+
+namespace RTOS {
+
+/**
+ * @brief   Order the workers take the jobs in, a job waits only for the jobs
+ * of a higher priority and the jobs of its own priority submitted before it.
+ */
+enum class job_priority_e : uint8_t { eHigh = 0U, eNormal, eLow };
+
+constexpr size_t JOB_PRIORITY_LEVELS = 3U;
+
+/**
+ * @brief   A callable copied into the job, for example a lambda capturing a
+ * few values.
+ *
+ *          The job is trivially copyable so a queue moves it by a plain copy,
+ * the callable lives in the job and never on a heap. A callable that is too
+ * big, needs its destructor or cannot be copied byte by byte fails to
+ * compile, capture a pointer to the data instead.
+ */
+class Job {
+public:
+  static constexpr size_t STORAGE_SIZE = RTOS_JOB_STORAGE_SIZE;
+
+  constexpr Job() : m_pInvoke(nullptr), m_storage() {}
+
+  /**
+   * @brief   Job constructor.
+   *
+   * @param   rCallable Called without arguments by a worker, copied.
+   */
+  template <typename F,
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job>>>
+  explicit Job(F const &rCallable) : m_pInvoke(&invoke<F>), m_storage() {
+    static_assert(sizeof(F) <= STORAGE_SIZE,
+                  "RTOS: The callable does not fit the job, see "
+                  "RTOS_JOB_STORAGE_SIZE!!");
+    static_assert(alignof(F) <= alignof(std::max_align_t),
+                  "RTOS: The callable is over aligned for the job!!");
+    static_assert(std::is_trivially_copyable_v<F> &&
+                      std::is_trivially_destructible_v<F>,
+                  "RTOS: A job is copied byte by byte and never destroyed, "
+                  "capture only values and pointers!!");
+    static_assert(std::is_invocable_r_v<void, F const &>,
+                  "RTOS: A job is called without arguments!!");
+
+    (void)::new (static_cast<void *>(m_storage)) F(rCallable);
+  }
+
+  /**
+   * @brief   Runs the callable, an empty job does nothing.
+   */
+  void operator()() const {
+    if (m_pInvoke != nullptr) {
+      m_pInvoke(m_storage);
+    }
+  }
+
+  bool is_empty() const { return m_pInvoke == nullptr; }
+
+private:
+  template <typename F> static void invoke(void const *const pStorage) {
+    (*std::launder(static_cast<F const *>(pStorage)))();
+  }
+
+  void (*m_pInvoke)(void const *);                   /**< Calls the storage. */
+  alignas(std::max_align_t) uint8_t m_storage[STORAGE_SIZE]; /**< Callable. */
+};
+
+/**
+ * @brief   Common part of the work queues, independent of the number of the
+ * workers and of the depth.
+ *
+ *          Each priority has a queue of its own. A counting semaphore counts
+ * the jobs in all the queues: a submit puts the job in its queue before it
+ * gives the semaphore, so a worker that takes the semaphore always finds a job
+ * and takes it from the highest priority that has one. Submitting checks for
+ * an ISR like TQueue::enqueue, from an ISR it never waits.
+ */
+class WorkQueueBase {
+public:
+  WorkQueueBase(WorkQueueBase const &) = delete;
+  WorkQueueBase &operator=(WorkQueueBase const &) = delete;
+
+  /**
+   * @brief   Hands a job to the workers.
+   *
+   * @param   rJob Job copied to the queue.
+   * @param   priority Queue the job goes to.
+   * @param   timeout Time to wait for room in the queue, 0 from an ISR.
+   * @return  true if the job is queued, false if its queue stayed full.
+   */
+  bool submit(Job const &rJob,
+              job_priority_e priority = job_priority_e::eNormal,
+              delay_t timeout = delay_t(0U));
+
+  /**
+   * @brief   Hands a callable to the workers, see Job for what fits.
+   */
+  template <typename F,
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job>>>
+  bool submit(F const &rCallable,
+              job_priority_e const priority = job_priority_e::eNormal,
+              delay_t const timeout = delay_t(0U)) {
+    return submit(Job(rCallable), priority, timeout);
+  }
+
+  /**
+   * @brief   Takes and runs the jobs forever, the body of every worker.
+   *
+   *          Any thread can call this to serve the queue as an extra worker.
+   */
+  [[noreturn]] void serve();
+
+  /**
+   * @brief   Number of jobs queued and not taken by a worker yet.
+   */
+  size_t get_pending() const {
+    return static_cast<size_t>(m_pending.get_count());
+  }
+
+  /**
+   * @brief   Number of jobs run to the end since the creation.
+   */
+  uint32_t get_completed() const {
+    return m_completed.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief   Number of submits that failed because the queue was full.
+   */
+  uint32_t get_rejected() const {
+    return m_rejected.load(std::memory_order_relaxed);
+  }
+
+protected:
+  /**
+   * @brief   WorkQueueBase constructor.
+   *
+   * @param   pSenders Queue of each priority, highest first.
+   * @param   pReceivers The same queues, to take the jobs from.
+   * @param   depth Number of jobs each queue holds.
+   */
+  WorkQueueBase(IQueueSender *const (&pSenders)[JOB_PRIORITY_LEVELS],
+                IQueueReceiver *const (&pReceivers)[JOB_PRIORITY_LEVELS],
+                size_t depth);
+
+  ~WorkQueueBase() = default;
+
+  /**
+   * @brief   Name of a worker, the name of the queue and the worker index.
+   */
+  struct worker_name_s {
+    char text[configMAX_TASK_NAME_LEN]; /**< Ends with a 0. */
+  };
+
+  static worker_name_s make_worker_name(name_t name, size_t index);
+
+private:
+  IQueueSender *m_pSenders[JOB_PRIORITY_LEVELS];
+  IQueueReceiver *m_pReceivers[JOB_PRIORITY_LEVELS];
+  CountingSemaphore m_pending;        /**< Jobs in all the queues.          */
+  std::atomic<uint32_t> m_completed;  /**< Jobs run since the creation.     */
+  std::atomic<uint32_t> m_rejected;   /**< Submits refused, queue was full. */
+};
+
+/**
+ * @brief   Holds the queue of each priority of a WorkQueue.
+ *
+ *          This is a base of the WorkQueue so the queues exist before the
+ * WorkQueueBase keeps pointers to them.
+ *
+ * @tparam Depth Number of jobs each priority holds.
+ */
+template <size_t Depth> struct WorkQueueStorage {
+  StaticTQueue<Job, Depth> m_queues[JOB_PRIORITY_LEVELS]; /**< By priority. */
+};
+
+/**
+ * @brief   Worker thread of a WorkQueue, serves the queue forever.
+ *
+ * @tparam StackDepth Number of words in the stack.
+ */
+template <stack_size_t StackDepth>
+class WorkQueueWorker : public StaticThread<StackDepth> {
+public:
+  WorkQueueWorker(WorkQueueBase &rQueue, name_t const name,
+                  priority_t const priority)
+      : StaticThread<StackDepth>(name, priority), m_rQueue(rQueue) {}
+
+  RET_STA_E thread_delete() override { return RET_STA_E::eRTOSSuccess; }
+
+private:
+  void run() override { m_rQueue.serve(); }
+
+  WorkQueueBase &m_rQueue;
+};
+
+/**
+ * @brief   Executor running short jobs on a fixed set of worker threads.
+ *
+ *          The work that used to take a thread of its own is submitted as a
+ * job instead, so the jobs share the stacks of the workers and a job costs a
+ * queue copy rather than a thread. The workers, their stacks and the queues
+ * are members of the object, nothing comes from a heap. A job runs to its end
+ * on a worker, a job that blocks keeps its worker from the other jobs.
+ *
+ *          The workers are created by start(), named after the queue with
+ * their index. Like Thread::join, start() is called from a running thread,
+ * the jobs submitted before it wait in the queues.
+ *
+ * @tparam Workers Number of worker threads.
+ * @tparam Depth Number of jobs each priority holds.
+ * @tparam StackDepth Number of words in the stack of each worker.
+ */
+template <size_t Workers, size_t Depth,
+          stack_size_t StackDepth = configMINIMAL_STACK_SIZE * 2>
+class WorkQueue : private WorkQueueStorage<Depth>, public WorkQueueBase {
+  static_assert(Workers > 0U, "RTOS: A work queue needs a worker.");
+
+public:
+  /**
+   * @brief   WorkQueue constructor.
+   *
+   * @param   name Name of the queue, the workers add their index to it.
+   * @param   priority Thread priority of every worker.
+   */
+  WorkQueue(name_t const name, priority_t const priority)
+      : WorkQueue(name, priority, std::make_index_sequence<Workers>{}) {}
+
+  ~WorkQueue() = default;
+
+  /**
+   * @brief   Creates the worker threads.
+   */
+  void start() {
+    for (WorkQueueWorker<StackDepth> &rWorker : m_workers) {
+      rWorker.join();
+    }
+  }
+
+  /**
+   * @brief   Worker thread with the given index, for its status and stack.
+   */
+  Thread &get_worker(size_t const index) { return m_workers[index]; }
+
+private:
+  using storage_t = WorkQueueStorage<Depth>;
+
+  template <size_t... Index>
+  WorkQueue(name_t const name, priority_t const priority,
+            std::index_sequence<Index...> /* indices */)
+      : storage_t(),
+        WorkQueueBase({&this->m_queues[0], &this->m_queues[1],
+                       &this->m_queues[2]},
+                      {&this->m_queues[0], &this->m_queues[1],
+                       &this->m_queues[2]},
+                      Depth),
+        m_workers{WorkQueueWorker<StackDepth>(
+            *this, make_worker_name(name, Index).text, priority)...} {}
+
+  WorkQueueWorker<StackDepth> m_workers[Workers]; /**< Serve the queues. */
+};
+} // namespace RTOS
+#endif // RTOS_WORK_QUEUE_HPP
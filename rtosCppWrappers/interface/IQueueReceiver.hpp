@@ -72,6 +72,20 @@ class IQueueReceiver {
    * @param   buffer Buffer for the item to be copied from the queue.
    */
   virtual void peek(void *buffer) = 0;
+
+  /**
+   * @brief   Receives up to item_count items from the queue.
+   *
+   *          Only the first item is waited for up to the wait time, the rest
+   * are received only while they are available on the queue.
+   *
+   * @param   pv_buffer buffer for item_count items placed back to back.
+   * @param   item_count maximum number of items to be received.
+   * @param   wait_time time for the thread to wait for the first item.
+   * @return  size_t Number of items received.
+   */
+  virtual size_t dequeue_n(void *pv_buffer, size_t item_count,
+                           delay_t wait_time) = 0;
 };
 } // namespace RTOS
 #endif // IQUEUE_RECEIVER_HPP
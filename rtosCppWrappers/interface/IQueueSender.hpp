@@ -72,6 +72,21 @@ public:
    * @param   pv_item_to_queue pointer to the object that has to be queued.
    */
   virtual void enqueue(const void *pv_item_to_queue) = 0;
+
+  /**
+   * @brief   Places up to item_count items at the back of the queue.
+   *
+   *          Only the first item waits for the space on the queue up to the
+   * wait time, the rest are placed only while there is space.
+   *
+   * @param   pv_items pointer to the items placed back to back.
+   * @param   item_count number of items to be queued.
+   * @param   wait_time Time for which the calling thread has to be blocked for
+   * queue space to be available for the first item.
+   * @return  size_t Number of items queued.
+   */
+  virtual size_t enqueue_n(const void *pv_items, size_t item_count,
+                           delay_t wait_time) = 0;
 };
 } // namespace RTOS
 
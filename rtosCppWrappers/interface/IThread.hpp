@@ -94,7 +94,8 @@ public:
   /**
    * @brief   Get the thread name.
    *
-   * @return  char const* Pointer to the name of the thread.
+   * @return  char const* Pointer to the name of the thread, valid while the
+   * thread object exists.
    */
   virtual char const *get_name() const = 0;
 
@@ -25,10 +25,14 @@
 #include "timers.h"
 
 /*--------------------------------------------------------*/
+#include <chrono>
 #include <cstdint>
 
 /*-------------------- Defines ---------------------------*/
-#ifdef SIM
+#if defined(SIM) && defined(POSIX_SIM)
+#include <csignal>
+#define debug_break std::raise(SIGTRAP)
+#elif defined(SIM)
 #define debug_break __debugbreak()
 // Note: The below have to be adjusted for other compilers as well.
 #else
@@ -74,12 +78,104 @@ using control_block_t = StaticTask_t *;
  */
 using thr_handle_t = TaskHandle_t;
 /**
- * @brief RTOS delay time.
+ * @brief RTOS delay time, held as kernel ticks.
+ *
+ *        A plain integer is taken as milliseconds, so delay_ms(500) keeps its
+ * meaning. Any std::chrono duration (10ms, 2s) or a tick count (5_ticks) is
+ * accepted as well. All the conversions are integer only and constexpr, so a
+ * constant time-out is already a tick count at compile time.
+ */
+class delay_t {
+public:
+  constexpr delay_t() : m_ticks(0U) {}
+
+  /**
+   * @brief Construct a delay from milliseconds, truncated like pdMS_TO_TICKS.
+   *
+   * @param milliseconds Delay in milli-seconds.
+   */
+  constexpr delay_t(uint32_t const milliseconds) // NOLINT(runtime/explicit)
+      : m_ticks(ms_to_ticks(milliseconds)) {}
+
+  /**
+   * @brief Construct a delay from a std::chrono duration, truncated to the
+   * tick period. Negative durations are 0 and too long ones wait forever.
+   *
+   * @param duration Delay as std::chrono duration.
+   */
+  template <typename Rep, typename Period>
+  constexpr delay_t( // NOLINT(runtime/explicit)
+      std::chrono::duration<Rep, Period> const duration)
+      : m_ticks(chrono_to_ticks(duration)) {}
+
+  /**
+   * @brief Construct a delay from the given number of ticks.
+   */
+  static constexpr delay_t from_ticks(TickType_t const ticks) {
+    delay_t delay;
+    delay.m_ticks = ticks;
+    return delay;
+  }
+
+  /**
+   * @brief Delay as number of ticks to be passed on to the kernel.
+   */
+  constexpr TickType_t ticks() const { return m_ticks; }
+
+  constexpr bool operator==(delay_t const rhs) const {
+    return m_ticks == rhs.m_ticks;
+  }
+  constexpr bool operator!=(delay_t const rhs) const {
+    return m_ticks != rhs.m_ticks;
+  }
+
+private:
+  using tick_period_t = std::ratio<1, configTICK_RATE_HZ>;
+
+  static constexpr TickType_t ms_to_ticks(uint32_t const milliseconds) {
+    /* Common case, one tick a milli-second needs no arithmetic at all. */
+    if constexpr (configTICK_RATE_HZ == 1000U) {
+      return static_cast<TickType_t>(milliseconds);
+    } else {
+      return saturate((static_cast<uint64_t>(milliseconds) *
+                       static_cast<uint64_t>(configTICK_RATE_HZ)) /
+                      1000U);
+    }
+  }
+
+  template <typename Rep, typename Period>
+  static constexpr TickType_t
+  chrono_to_ticks(std::chrono::duration<Rep, Period> const duration) {
+    using ticks_t = std::chrono::duration<uint64_t, tick_period_t>;
+    return (duration <= duration.zero())
+               ? 0U
+               : saturate(
+                     std::chrono::duration_cast<ticks_t>(duration).count());
+  }
+
+  static constexpr TickType_t saturate(uint64_t const ticks) {
+    return (ticks >= static_cast<uint64_t>(portMAX_DELAY))
+               ? static_cast<TickType_t>(portMAX_DELAY)
+               : static_cast<TickType_t>(ticks);
+  }
+
+  TickType_t m_ticks; /**< Delay in kernel ticks.                          */
+};
+
+/**
+ * @brief Blocks until the operation completes.
  */
-using delay_t = float;
 constexpr delay_t wait_forever =
-    static_cast<float>(0xffffffffUL * 1000 /
-                       configTICK_RATE_HZ); // NOLINT(bugprone-integer-division)
+    delay_t::from_ticks(static_cast<TickType_t>(portMAX_DELAY));
+
+namespace literals {
+/**
+ * @brief Delay given in kernel ticks, e.g. 5_ticks.
+ */
+constexpr delay_t operator""_ticks(unsigned long long const ticks) {
+  return delay_t::from_ticks(static_cast<TickType_t>(ticks));
+}
+} // namespace literals
 
 /**
  * @brief Type for the notification value.BaseType_t
@@ -0,0 +1,247 @@
+/**
+ * @file        BinaryLog.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the logger that sends the log lines unformatted, to
+ * be formatted by the host decoder.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "BinaryLog.hpp"
+
+#if RTOS_LOG_USE_RTT == 1
+#include "SEGGER_RTT.h"
+#endif
+
+namespace RTOS {
+
+namespace {
+/* Words a record of the given bytes takes in the ring, with its length. */
+constexpr uint32_t words_of(size_t const length) {
+  return static_cast<uint32_t>(
+      1U + ((length + sizeof(uint32_t) - 1U) / sizeof(uint32_t)));
+}
+} // namespace
+
+/*--------- static value initialization ---------*/
+BinaryLog BinaryLog::m_rBinaryLog;
+/*----------------------------------------------*/
+
+BinaryLog &BinaryLog::get_Instance() { return m_rBinaryLog; }
+
+uint32_t BinaryLog::get_timestamp() {
+#if configGENERATE_RUN_TIME_STATS == 1
+  return portGET_RUN_TIME_COUNTER_VALUE();
+#else
+  /* If the call is made from a ISR or Application and call relv. api. */
+  if (xPortIsInsideInterrupt() == pdTRUE) {
+    return static_cast<uint32_t>(xTaskGetTickCountFromISR());
+  }
+  return static_cast<uint32_t>(xTaskGetTickCount());
+#endif
+}
+
+uint32_t BinaryLog::get_timestamp_frequency() {
+#if configGENERATE_RUN_TIME_STATS == 1
+  return configRUN_TIME_COUNTER_HZ;
+#else
+  return configTICK_RATE_HZ;
+#endif
+}
+
+bool BinaryLog::write_line(log_site_s &rSite, char const *const pFormat,
+                           uint8_t *const pRecord, size_t const length,
+                           uint8_t const arg_count, uint8_t const wide_mask) {
+  if (!is_started()) {
+    return drop();
+  }
+  if (!rSite.isDefined.load(std::memory_order_acquire) &&
+      !define_format(rSite, pFormat)) {
+    return drop();
+  }
+
+  uint32_t const id = rSite.id.load(std::memory_order_relaxed);
+  uint32_t const timestamp = get_timestamp();
+  pRecord[0] = static_cast<uint8_t>(LogFormat::record_e::eLine);
+  pRecord[1] = arg_count;
+  pRecord[2] = wide_mask;
+  std::memcpy(&pRecord[3], &id, sizeof(id));
+  std::memcpy(&pRecord[7], &timestamp, sizeof(timestamp));
+
+  /* The report goes before the line so the gap is at the right place. */
+  if (m_droppedPending.load(std::memory_order_relaxed) != 0U) {
+    report_dropped();
+  }
+  if (!put(pRecord, length)) {
+    return drop();
+  }
+  return true;
+}
+
+bool BinaryLog::is_started() {
+  state_e state = m_state.load(std::memory_order_acquire);
+  if (state == state_e::eReady) {
+    return true;
+  }
+  /* Only one caller starts the log, the others drop their lines meanwhile. */
+  if ((state != state_e::eIdle) ||
+      !m_state.compare_exchange_strong(state, state_e::eStarting,
+                                       std::memory_order_acquire)) {
+    return false;
+  }
+
+#if RTOS_LOG_USE_RTT == 1
+  int const channel = SEGGER_RTT_AllocUpBuffer("BinaryLog", m_buffer,
+                                               sizeof(m_buffer),
+                                               SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+  if (channel < 0) {
+    /* No free up buffer, see RTT_UP_BUFF_CNT. */
+    debug_break;
+    m_state.store(state_e::eIdle, std::memory_order_release);
+    return false;
+  }
+  m_channel = static_cast<unsigned>(channel);
+#endif
+
+  uint8_t record[LogFormat::START_SIZE];
+  uint32_t const frequency = get_timestamp_frequency();
+  record[0] = static_cast<uint8_t>(LogFormat::record_e::eStart);
+  record[1] = LogFormat::VERSION;
+  std::memcpy(&record[2], &frequency, sizeof(frequency));
+
+  /* The log is empty at the start, so the record always fits. */
+  (void)put(record, sizeof(record));
+  m_state.store(state_e::eReady, std::memory_order_release);
+  return true;
+}
+
+bool BinaryLog::define_format(log_site_s &rSite, char const *const pFormat) {
+  uint32_t id = rSite.id.load(std::memory_order_relaxed);
+  if (id == 0U) {
+    /* A site used by two callers at once keeps the first id given. */
+    uint32_t const newId = m_nextId.fetch_add(1U, std::memory_order_relaxed);
+    id = rSite.id.compare_exchange_strong(id, newId, std::memory_order_relaxed)
+             ? newId
+             : id;
+  }
+
+  size_t formatLength = std::strlen(pFormat);
+  if (formatLength > LogFormat::MAX_FORMAT_LENGTH) {
+    formatLength = LogFormat::MAX_FORMAT_LENGTH;
+  }
+
+  uint8_t record[LogFormat::MAX_FORMAT_SIZE];
+  record[0] = static_cast<uint8_t>(LogFormat::record_e::eFormat);
+  record[1] = static_cast<uint8_t>(formatLength);
+  std::memcpy(&record[2], &id, sizeof(id));
+  std::memcpy(&record[LogFormat::FORMAT_HEADER_SIZE], pFormat, formatLength);
+
+  if (!put(record, LogFormat::FORMAT_HEADER_SIZE + formatLength)) {
+    return false;
+  }
+  rSite.isDefined.store(true, std::memory_order_release);
+  return true;
+}
+
+void BinaryLog::report_dropped() {
+  uint32_t const count =
+      m_droppedPending.exchange(0U, std::memory_order_relaxed);
+  if (count == 0U) {
+    return;
+  }
+
+  uint8_t record[LogFormat::DROPPED_SIZE];
+  record[0] = static_cast<uint8_t>(LogFormat::record_e::eDropped);
+  std::memcpy(&record[1], &count, sizeof(count));
+  if (!put(record, sizeof(record))) {
+    (void)m_droppedPending.fetch_add(count, std::memory_order_relaxed);
+  }
+}
+
+bool BinaryLog::drop() {
+  (void)m_droppedPending.fetch_add(1U, std::memory_order_relaxed);
+  (void)m_droppedTotal.fetch_add(1U, std::memory_order_relaxed);
+  return false;
+}
+
+#if RTOS_LOG_USE_RTT == 1
+
+bool BinaryLog::put(uint8_t const *const pRecord, size_t const length) {
+  /* The skip mode writes the whole record or nothing. */
+  return SEGGER_RTT_Write(m_channel, pRecord, static_cast<unsigned>(length)) ==
+         length;
+}
+
+size_t BinaryLog::read(void *const pBuffer, size_t const size) {
+  /* The debug probe reads the up buffer. */
+  (void)pBuffer;
+  (void)size;
+  return 0U;
+}
+
+#else
+
+bool BinaryLog::put(uint8_t const *const pRecord, size_t const length) {
+  uint32_t const words = words_of(length);
+
+  /* Reserve the words, retried only if another writer reserved meanwhile. */
+  uint32_t start = m_reserved.load(std::memory_order_relaxed);
+  do {
+    uint32_t const released = m_released.load(std::memory_order_acquire);
+    if (((start - released) + words) > RING_WORDS) {
+      return false;
+    }
+  } while (!m_reserved.compare_exchange_weak(start, start + words,
+                                             std::memory_order_relaxed));
+
+  for (uint32_t word = 1U; word < words; ++word) {
+    size_t const offset = (word - 1U) * sizeof(uint32_t);
+    size_t const remaining = length - offset;
+    uint32_t value = 0U;
+    std::memcpy(&value, &pRecord[offset],
+                (remaining < sizeof(value)) ? remaining : sizeof(value));
+    m_words[(start + word) & RING_MASK].store(value,
+                                              std::memory_order_relaxed);
+  }
+  /* The length is stored last, the reader takes the record once it is set. */
+  m_words[start & RING_MASK].store(static_cast<uint32_t>(length),
+                                   std::memory_order_release);
+  return true;
+}
+
+size_t BinaryLog::read(void *const pBuffer, size_t const size) {
+  uint8_t *const pBytes = static_cast<uint8_t *>(pBuffer);
+  uint32_t start = m_released.load(std::memory_order_relaxed);
+  size_t copied = 0U;
+
+  for (;;) {
+    uint32_t const length =
+        m_words[start & RING_MASK].load(std::memory_order_acquire);
+    /* Empty, or the next record is still being written. */
+    if ((length == 0U) || ((copied + length) > size)) {
+      break;
+    }
+
+    uint32_t const words = words_of(length);
+    for (uint32_t word = 1U; word < words; ++word) {
+      size_t const offset = (word - 1U) * sizeof(uint32_t);
+      size_t const remaining = length - offset;
+      uint32_t const value = m_words[(start + word) & RING_MASK].exchange(
+          0U, std::memory_order_relaxed);
+      std::memcpy(&pBytes[copied + offset], &value,
+                  (remaining < sizeof(value)) ? remaining : sizeof(value));
+    }
+    m_words[start & RING_MASK].store(0U, std::memory_order_relaxed);
+
+    copied += length;
+    start += words;
+    /* The cleared words go back to the writers. */
+    m_released.store(start, std::memory_order_release);
+  }
+  return copied;
+}
+#endif
+} // namespace RTOS
@@ -0,0 +1,132 @@
+/**
+ * @file        EventGroup.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the event group for waits on several conditions.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "EventGroup.hpp"
+
+namespace RTOS {
+
+EventGroup::EventGroup()
+    : m_eventGroupCB(), m_handle(xEventGroupCreateStatic(&m_eventGroupCB)) {}
+
+EventGroup::~EventGroup() {
+  /* Threads waiting on the group are released with a timeout. */
+  if (m_handle != nullptr) {
+    vEventGroupDelete(m_handle);
+  }
+}
+
+bool EventGroup::set(event_bits_t const bits) {
+
+  base_t ret_val = pdFALSE;
+  if ((m_handle != nullptr) && ((bits & ~ALL_BITS) == 0U)) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+#if configUSE_TIMERS == 1
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xEventGroupSetBitsFromISR(m_handle, bits, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+#else
+      /* Without the timer daemon the bits cannot be set from an ISR. */
+      debug_break;
+#endif
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      (void)xEventGroupSetBits(m_handle, bits);
+      ret_val = pdTRUE;
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+bool EventGroup::clear(event_bits_t const bits) {
+
+  base_t ret_val = pdFALSE;
+  if ((m_handle != nullptr) && ((bits & ~ALL_BITS) == 0U)) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+#if configUSE_TIMERS == 1
+      ret_val = xEventGroupClearBitsFromISR(m_handle, bits);
+#else
+      /* Without the timer daemon the bits cannot be cleared from an ISR. */
+      debug_break;
+#endif
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      (void)xEventGroupClearBits(m_handle, bits);
+      ret_val = pdTRUE;
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+event_bits_t EventGroup::get() const {
+  event_bits_t bits = 0U;
+  if (m_handle != nullptr) {
+    bits = (xPortIsInsideInterrupt() == pdTRUE)
+               ? xEventGroupGetBitsFromISR(m_handle)
+               : xEventGroupGetBits(m_handle);
+  }
+  return bits;
+}
+
+event_bits_t EventGroup::wait_any(event_bits_t const bits,
+                                  delay_t const timeout,
+                                  bool const isClearOnExit) {
+  return wait(bits, timeout, isClearOnExit, false);
+}
+
+event_bits_t EventGroup::wait_all(event_bits_t const bits,
+                                  delay_t const timeout,
+                                  bool const isClearOnExit) {
+  return wait(bits, timeout, isClearOnExit, true);
+}
+
+bool EventGroup::sync(event_bits_t const set_bits,
+                      event_bits_t const wait_bits, delay_t const timeout) {
+  bool isMet = false;
+  if ((m_handle != nullptr) && (xPortIsInsideInterrupt() == pdFALSE) &&
+      (((set_bits | wait_bits) & ~ALL_BITS) == 0U) && (wait_bits != 0U)) {
+    event_bits_t const bits =
+        xEventGroupSync(m_handle, set_bits, wait_bits, timeout.ticks());
+    isMet = ((bits & wait_bits) == wait_bits);
+  } else {
+    debug_break;
+  }
+  return isMet;
+}
+
+event_bits_t EventGroup::wait(event_bits_t const bits, delay_t const timeout,
+                              bool const isClearOnExit,
+                              bool const isWaitForAll) {
+  event_bits_t value = 0U;
+  /* The kernel asserts on waiting for no bits or the reserved bits. */
+  if ((m_handle != nullptr) && (xPortIsInsideInterrupt() == pdFALSE) &&
+      ((bits & ~ALL_BITS) == 0U) && (bits != 0U)) {
+    value = xEventGroupWaitBits(m_handle, bits,
+                                isClearOnExit ? pdTRUE : pdFALSE,
+                                isWaitForAll ? pdTRUE : pdFALSE,
+                                timeout.ticks());
+  } else {
+    debug_break;
+  }
+  return value;
+}
+
+} // namespace RTOS
@@ -0,0 +1,50 @@
+/**
+ * @file        FixedBlockPool.cpp
+ * @author      Tummala Manish (manish.tummala@gmail.com)
+ * @brief       Implements the fixed size block pool used by the memory
+ * manager.
+ * @version     0.1
+ * @date        2021-07-27
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "FixedBlockPool.hpp"
+
+namespace RTOS {
+
+void *FixedBlockPool::allocate() {
+  void *pBlock = nullptr;
+
+  taskENTER_CRITICAL();
+  /* Released blocks are reused first. */
+  if (m_pFreeHead != nullptr) {
+    pBlock = m_pFreeHead;
+    m_pFreeHead = *static_cast<void **>(pBlock);
+  }
+  /* Else hand out the next block that was never used. */
+  else if (m_nextUnused < m_blockCount) {
+    pBlock = &m_pArena[m_nextUnused * m_blockSize];
+    ++m_nextUnused;
+  }
+  taskEXIT_CRITICAL();
+
+  return pBlock;
+}
+
+void FixedBlockPool::release(void *const pBlock) {
+  taskENTER_CRITICAL();
+  /* The link to the next free block is kept in the block itself. */
+  *static_cast<void **>(pBlock) = m_pFreeHead;
+  m_pFreeHead = pBlock;
+  taskEXIT_CRITICAL();
+}
+
+bool FixedBlockPool::owns(const void *const pMemory) const {
+  auto const *const pByte = static_cast<const uint8_t *>(pMemory);
+  return (pByte >= m_pArena) &&
+         (pByte < &m_pArena[m_blockCount * m_blockSize]);
+}
+
+} // namespace RTOS
@@ -11,17 +11,81 @@
  */
 
 #include "MemoryManager.hpp"
+#include "FixedBlockPool.hpp"
+
+/*------------- Pool configuration, see memoryManagerConfiguration.cmake -----*/
+#ifndef RTOS_MEM_TASK_CB_POOL_COUNT
+#define RTOS_MEM_TASK_CB_POOL_COUNT 0
+#endif
+#ifndef RTOS_MEM_QUEUE_CB_POOL_COUNT
+#define RTOS_MEM_QUEUE_CB_POOL_COUNT 0
+#endif
+#ifndef RTOS_MEM_SMALL_BLOCK_SIZE
+#define RTOS_MEM_SMALL_BLOCK_SIZE 32
+#endif
+#ifndef RTOS_MEM_SMALL_BLOCK_COUNT
+#define RTOS_MEM_SMALL_BLOCK_COUNT 0
+#endif
+#ifndef RTOS_MEM_MEDIUM_BLOCK_SIZE
+#define RTOS_MEM_MEDIUM_BLOCK_SIZE 128
+#endif
+#ifndef RTOS_MEM_MEDIUM_BLOCK_COUNT
+#define RTOS_MEM_MEDIUM_BLOCK_COUNT 0
+#endif
+#ifndef RTOS_MEM_LARGE_BLOCK_SIZE
+#define RTOS_MEM_LARGE_BLOCK_SIZE 512
+#endif
+#ifndef RTOS_MEM_LARGE_BLOCK_COUNT
+#define RTOS_MEM_LARGE_BLOCK_COUNT 0
+#endif
 
 namespace RTOS {
 
+namespace {
+/**
+ * @brief   Bytes needed by the arena of a pool, at least one to keep the array
+ * legal for an empty pool.
+ */
+constexpr size_t arena_size(size_t const blockSize, size_t const blockCount) {
+  return blockCount > 0U ? FixedBlockPool::block_size_for(blockSize) * blockCount
+                         : 1U;
+}
+
+/*
+ * The arenas are outside of the RTOS heap and the pools are constant
+ * initialized, so they can be used by the constructors of other static objects.
+ */
+alignas(portBYTE_ALIGNMENT) uint8_t
+    s_taskCBArena[arena_size(sizeof(StaticTask_t), RTOS_MEM_TASK_CB_POOL_COUNT)];
+alignas(portBYTE_ALIGNMENT) uint8_t s_queueCBArena[arena_size(
+    sizeof(StaticQueue_t), RTOS_MEM_QUEUE_CB_POOL_COUNT)];
+alignas(portBYTE_ALIGNMENT) uint8_t s_smallArena[arena_size(
+    RTOS_MEM_SMALL_BLOCK_SIZE, RTOS_MEM_SMALL_BLOCK_COUNT)];
+alignas(portBYTE_ALIGNMENT) uint8_t s_mediumArena[arena_size(
+    RTOS_MEM_MEDIUM_BLOCK_SIZE, RTOS_MEM_MEDIUM_BLOCK_COUNT)];
+alignas(portBYTE_ALIGNMENT) uint8_t s_largeArena[arena_size(
+    RTOS_MEM_LARGE_BLOCK_SIZE, RTOS_MEM_LARGE_BLOCK_COUNT)];
+
+FixedBlockPool s_taskCBPool(s_taskCBArena, sizeof(StaticTask_t),
+                            RTOS_MEM_TASK_CB_POOL_COUNT);
+FixedBlockPool s_queueCBPool(s_queueCBArena, sizeof(StaticQueue_t),
+                             RTOS_MEM_QUEUE_CB_POOL_COUNT);
+
+/* Size classes in the ascending order of the block size. */
+FixedBlockPool s_sizeClasses[] = {
+    {s_smallArena, RTOS_MEM_SMALL_BLOCK_SIZE, RTOS_MEM_SMALL_BLOCK_COUNT},
+    {s_mediumArena, RTOS_MEM_MEDIUM_BLOCK_SIZE, RTOS_MEM_MEDIUM_BLOCK_COUNT},
+    {s_largeArena, RTOS_MEM_LARGE_BLOCK_SIZE, RTOS_MEM_LARGE_BLOCK_COUNT},
+};
+
+static_assert((RTOS_MEM_SMALL_BLOCK_SIZE <= RTOS_MEM_MEDIUM_BLOCK_SIZE) &&
+                  (RTOS_MEM_MEDIUM_BLOCK_SIZE <= RTOS_MEM_LARGE_BLOCK_SIZE),
+              "RTOS: Size classes have to be in the ascending order.");
+} // namespace
+
 // Warning: Usage of a singleton. The presence is essential for the operation.
 MemoryManager MemoryManager::m_rMemoryManager;
 
-MemoryManager::MemoryManager() {
-  /*TODO: This implementation can be improved to have book keeping of the
-   * memory.*/
-}
-
 MemoryManager &MemoryManager::get_Instance() { return m_rMemoryManager; }
 
 /*Note: This is not a const function because we might want to add book keeping
@@ -29,24 +93,162 @@ MemoryManager &MemoryManager::get_Instance() { return m_rMemoryManager; }
 eMemoryResult MemoryManager::get_stack(stack_t &ppStack,
                                        stack_size_t StackSize) {
 
-  ppStack =
-      static_cast<StackType_t *>(pvPortMalloc(StackSize * sizeof(StackType_t)));
+  ppStack = static_cast<StackType_t *>(
+      allocate(StackSize * sizeof(StackType_t), mem_category_e::eStackMemory));
   return ppStack != nullptr ? eMemAllocationSuccess : eMemAllocationFailed;
 }
 
-void MemoryManager::release_stack(stack_t ppStack) { vPortFree(ppStack); }
+void MemoryManager::release_stack(stack_t ppStack) {
+  release(ppStack, mem_category_e::eStackMemory);
+}
 
-void MemoryManager::release_CB(void *pCB) { vPortFree(pCB); }
+void MemoryManager::release_CB(void *pCB) {
+  release(pCB, mem_category_e::eControlBlockMemory);
+}
 
 /*Note: This is not a const function because we might want to add book keeping
    feature to the memory manager. Same reason these are not static functions*/
 eMemoryResult MemoryManager::get_block(void **pMemHolder, size_t iNumBytes) {
 
-  *pMemHolder = pvPortMalloc(iNumBytes);
+  *pMemHolder = allocate(iNumBytes, mem_category_e::eBlockMemory);
   return *pMemHolder != nullptr ? eMemAllocationSuccess : eMemAllocationFailed;
 }
 
-void MemoryManager::release_block(void *pMemHolder) { vPortFree(pMemHolder); }
+void MemoryManager::release_block(void *pMemHolder) {
+  release(pMemHolder, mem_category_e::eBlockMemory);
+}
+
+mem_usage_s MemoryManager::get_usage(mem_category_e const category) const {
+  taskENTER_CRITICAL();
+  mem_usage_s const usage = m_usage[static_cast<size_t>(category)];
+  taskEXIT_CRITICAL();
+  return usage;
+}
+
+heap_stats_s MemoryManager::get_heap_stats() {
+  HeapStats_t kernelStats{};
+  vPortGetHeapStats(&kernelStats);
+  return {kernelStats.xAvailableHeapSpaceInBytes,
+          xPortGetMinimumEverFreeHeapSize(),
+          kernelStats.xSizeOfLargestFreeBlockInBytes};
+}
+
+void *MemoryManager::allocate_CB(size_t const iNumBytes,
+                                 cb_pool_e const pool) {
+  void *pCB = nullptr;
+  FixedBlockPool *pPool = nullptr;
+
+  /* Try the pool dedicated to the control block type. */
+  if (pool == cb_pool_e::eTaskCBPool) {
+    pPool = &s_taskCBPool;
+  } else if (pool == cb_pool_e::eQueueCBPool) {
+    pPool = &s_queueCBPool;
+  }
+  if (pPool != nullptr) {
+    pCB = pPool->allocate();
+  }
+
+  /* Dedicated pool is exhausted or there is none. */
+  if (pCB == nullptr) {
+    pCB = allocate(iNumBytes, mem_category_e::eControlBlockMemory);
+  } else {
+    account_allocation(mem_category_e::eControlBlockMemory,
+                       pPool->block_size());
+  }
+  return pCB;
+}
+
+void *MemoryManager::allocate(size_t const iNumBytes,
+                              mem_category_e const category) {
+  void *pMemory = nullptr;
+  size_t taken = 0U;
+
+  /* Smallest size class that fits and still has a free block. */
+  for (auto &sizeClass : s_sizeClasses) {
+    if (iNumBytes <= sizeClass.block_size()) {
+      pMemory = sizeClass.allocate();
+      if (pMemory != nullptr) {
+        taken = sizeClass.block_size();
+        break;
+      }
+    }
+  }
+
+  /* No pool could serve the request. */
+  if (pMemory == nullptr) {
+    /* The free heap delta includes the heap's own overhead of the block. */
+    vTaskSuspendAll();
+    size_t const freeBefore = xPortGetFreeHeapSize();
+    pMemory = pvPortMalloc(iNumBytes);
+    taken = freeBefore - xPortGetFreeHeapSize();
+    (void)xTaskResumeAll();
+  }
+
+  account_allocation(category, pMemory != nullptr ? taken : 0U);
+  return pMemory;
+}
+
+void MemoryManager::release(void *const pMemory,
+                            mem_category_e const category) {
+  FixedBlockPool *pPool = nullptr;
+  size_t given = 0U;
+
+  if (s_taskCBPool.owns(pMemory)) {
+    pPool = &s_taskCBPool;
+  } else if (s_queueCBPool.owns(pMemory)) {
+    pPool = &s_queueCBPool;
+  } else {
+    for (auto &sizeClass : s_sizeClasses) {
+      if (sizeClass.owns(pMemory)) {
+        pPool = &sizeClass;
+        break;
+      }
+    }
+  }
+
+  if (pPool != nullptr) {
+    pPool->release(pMemory);
+    given = pPool->block_size();
+  }
+  /* Not from any of the pools. */
+  else if (pMemory != nullptr) {
+    vTaskSuspendAll();
+    size_t const freeBefore = xPortGetFreeHeapSize();
+    vPortFree(pMemory);
+    given = xPortGetFreeHeapSize() - freeBefore;
+    (void)xTaskResumeAll();
+  }
+
+  if (given > 0U) {
+    m_rMemoryManager.account_release(category, given);
+  }
+}
+
+void MemoryManager::account_allocation(mem_category_e const category,
+                                       size_t const iNumBytes) {
+  mem_usage_s &usage = m_usage[static_cast<size_t>(category)];
+
+  taskENTER_CRITICAL();
+  if (iNumBytes > 0U) {
+    usage.current_bytes += iNumBytes;
+    ++usage.allocation_count;
+    if (usage.current_bytes > usage.peak_bytes) {
+      usage.peak_bytes = usage.current_bytes;
+    }
+  } else {
+    ++usage.failed_allocations;
+  }
+  taskEXIT_CRITICAL();
+}
+
+void MemoryManager::account_release(mem_category_e const category,
+                                    size_t const iNumBytes) {
+  mem_usage_s &usage = m_usage[static_cast<size_t>(category)];
+
+  taskENTER_CRITICAL();
+  usage.current_bytes -= iNumBytes;
+  taskEXIT_CRITICAL();
+}
 
 } // namespace RTOS
 
@@ -58,8 +58,7 @@ bool Mutex::lock(RTOS::delay_t timeOut) {
 
     /* Not in an ISR so using normal flavour if the api. */
     else {
-      ret_val = xSemaphoreTake(m_mutexHandle,
-                               static_cast<TickType_t>(pdMS_TO_TICKS(timeOut)));
+      ret_val = xSemaphoreTake(m_mutexHandle, timeOut.ticks());
     }
   }
   return ret_val == pdTRUE;
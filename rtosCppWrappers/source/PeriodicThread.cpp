@@ -0,0 +1,84 @@
+/**
+ * @file        PeriodicThread.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the thread that runs its work at a fixed period.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "PeriodicThread.hpp"
+
+namespace RTOS {
+
+PeriodicThread::PeriodicThread(name_t const thread_name,
+                               priority_t const thread_priority,
+                               stack_size_t const thread_stack_size,
+                               delay_t const period, id_t const thread_id)
+    : Thread(thread_name, thread_priority, thread_stack_size, thread_id),
+      m_period(period), m_lastWakeTime(0U), m_stats(),
+      m_isStopRequested(false) {
+  /* A period of 0 ticks can never be met. */
+  if (period.ticks() == 0U) {
+    debug_break;
+  }
+}
+
+period_stats_s PeriodicThread::get_period_stats() const {
+  /* The 64 bit total is not written atomically on a 32 bit target. */
+  taskENTER_CRITICAL();
+  period_stats_s const stats = m_stats;
+  taskEXIT_CRITICAL();
+  return stats;
+}
+
+void PeriodicThread::reset_period_stats() {
+  taskENTER_CRITICAL();
+  m_stats = period_stats_s();
+  taskEXIT_CRITICAL();
+}
+
+void PeriodicThread::run() {
+  m_lastWakeTime = xTaskGetTickCount();
+  while (!m_isStopRequested) {
+    run_period();
+    wait_for_next_period();
+  }
+}
+
+void PeriodicThread::wait_for_next_period() {
+  bool const isOnTime = delay_until(m_lastWakeTime, m_period);
+
+  /* The last wake time is now the scheduled wake time of this period. */
+  TickType_t const late_ticks = xTaskGetTickCount() - m_lastWakeTime;
+
+  /* The kernel does not wait when the period ends on the wake tick itself,
+  that period is still on time. */
+  bool const isOverrun = !isOnTime && (late_ticks != 0U);
+
+  if (isOverrun) {
+    /* Skip the wake times that already passed, staying on the same grid. */
+    TickType_t const missed_periods = late_ticks / m_period.ticks();
+    m_lastWakeTime += missed_periods * m_period.ticks();
+  }
+
+  taskENTER_CRITICAL();
+  ++m_stats.period_count;
+  m_stats.last_jitter = late_ticks;
+  if (m_stats.last_jitter > m_stats.max_jitter) {
+    m_stats.max_jitter = m_stats.last_jitter;
+  }
+  m_stats.total_jitter += m_stats.last_jitter;
+  if (isOverrun) {
+    ++m_stats.overrun_count;
+  }
+  taskEXIT_CRITICAL();
+
+  if (isOverrun) {
+    on_overrun(late_ticks);
+  }
+}
+
+} // namespace RTOS
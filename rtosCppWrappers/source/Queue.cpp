@@ -11,11 +11,13 @@
 
 #include "Queue.hpp"
 #include "MemoryManager.hpp"
+#include "QueueBatch.hpp"
 
 namespace RTOS {
 
 Queue::Queue(const base_t queue_length, const base_t item_length)
-    : m_pHandle(nullptr), m_pQueueCB(nullptr), m_pBuffer(nullptr) {
+    : m_pHandle(nullptr), m_pQueueCB(nullptr), m_pBuffer(nullptr),
+      m_itemLength(static_cast<size_t>(item_length)) {
 
   /* Try and successfully get the control block for queue. */
   bool isSuccessful = MemoryManager::get_Instance().get_CB(&m_pQueueCB) ==
@@ -54,7 +56,7 @@ RET_STA_E Queue::enqueue_to_front(const void *const pv_item_to_queue,
   if (xPortIsInsideInterrupt() == pdTRUE) {
 
     /* Check if the api call can be made with no blocking. */
-    if (wait_time == 0.0f) {
+    if (wait_time.ticks() == 0U) {
       base_t isYieldRequired = 0U;
       ret_val = xQueueSendToFrontFromISR(m_pHandle, pv_item_to_queue,
                                          &isYieldRequired);
@@ -73,8 +75,7 @@ RET_STA_E Queue::enqueue_to_front(const void *const pv_item_to_queue,
 
   /* Call is not from an ISR use non ISR flavour. */
   else {
-    ret_val = xQueueSendToFront(m_pHandle, pv_item_to_queue,
-                                pdMS_TO_TICKS(wait_time));
+    ret_val = xQueueSendToFront(m_pHandle, pv_item_to_queue, wait_time.ticks());
   }
   return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess : RET_STA_E::eRTOSFailure;
 }
@@ -90,7 +91,7 @@ RET_STA_E Queue::enqueue(const void *const pv_item_to_queue,
   if (xPortIsInsideInterrupt() == pdTRUE) {
 
     /* Check if the api call can be made with no blocking. */
-    if (wait_time == 0.0f) {
+    if (wait_time.ticks() == 0U) {
       base_t isYieldRequired = 0U;
       ret_val = xQueueSendToBackFromISR(m_pHandle, pv_item_to_queue,
                                         &isYieldRequired);
@@ -109,8 +110,7 @@ RET_STA_E Queue::enqueue(const void *const pv_item_to_queue,
 
   /* Call is not from an ISR use non ISR flavour. */
   else {
-    ret_val =
-        xQueueSendToBack(m_pHandle, pv_item_to_queue, pdMS_TO_TICKS(wait_time));
+    ret_val = xQueueSendToBack(m_pHandle, pv_item_to_queue, wait_time.ticks());
   }
   return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess : RET_STA_E::eRTOSFailure;
 }
@@ -119,6 +119,12 @@ void Queue::enqueue(const void *const pv_item_to_queue) {
   (void)enqueue(pv_item_to_queue, wait_forever);
 }
 
+size_t Queue::enqueue_n(const void *const pv_items, size_t const item_count,
+                        delay_t const wait_time) {
+  return queue_send_n(m_pHandle, static_cast<const uint8_t *>(pv_items),
+                      m_itemLength, item_count, wait_time);
+}
+
 RET_STA_E Queue::dequeue(void *const pv_buffer, delay_t wait_time) {
 
   base_t ret_val = 0U;
@@ -126,7 +132,7 @@ RET_STA_E Queue::dequeue(void *const pv_buffer, delay_t wait_time) {
   if (xPortIsInsideInterrupt() == pdTRUE) {
 
     /* Check if the api call can be made with no blocking. */
-    if (wait_time == 0.0f) {
+    if (wait_time.ticks() == 0U) {
       base_t isYieldRequired = 0U;
       ret_val = xQueueReceiveFromISR(m_pHandle, pv_buffer, &isYieldRequired);
       /* Check if a context switch is required. */
@@ -144,14 +150,14 @@ RET_STA_E Queue::dequeue(void *const pv_buffer, delay_t wait_time) {
 
   /* Call is not from an ISR use non ISR flavour. */
   else {
-    ret_val = xQueueReceive(m_pHandle, pv_buffer, pdMS_TO_TICKS(wait_time));
+    ret_val = xQueueReceive(m_pHandle, pv_buffer, wait_time.ticks());
   }
 
   return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess : RET_STA_E::eRTOSFailure;
 }
 
 void Queue::dequeue(void *const pv_buffer) {
-  (void)dequeue(pv_buffer, pdMS_TO_TICKS(wait_forever));
+  (void)dequeue(pv_buffer, wait_forever);
 }
 
 RET_STA_E Queue::peek(void *const pv_buffer, delay_t wait_time) {
@@ -161,7 +167,7 @@ RET_STA_E Queue::peek(void *const pv_buffer, delay_t wait_time) {
   if (xPortIsInsideInterrupt() == pdTRUE) {
 
     /* Check if the api call can be made with no blocking. */
-    if (wait_time == 0.0f) {
+    if (wait_time.ticks() == 0U) {
       ret_val = xQueuePeekFromISR(m_pHandle, pv_buffer);
     } else {
       /* Cannot post to a queue with a blocking time from an ISR. */
@@ -171,13 +177,19 @@ RET_STA_E Queue::peek(void *const pv_buffer, delay_t wait_time) {
 
   /* Call is not from an ISR use non ISR flavour. */
   else {
-    ret_val = xQueuePeek(m_pHandle, pv_buffer, pdMS_TO_TICKS(wait_time));
+    ret_val = xQueuePeek(m_pHandle, pv_buffer, wait_time.ticks());
   }
   return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess : RET_STA_E::eRTOSFailure;
 }
 
 void Queue::peek(void *const buffer) {
-  (void)peek(buffer, pdMS_TO_TICKS(wait_forever));
+  (void)peek(buffer, wait_forever);
+}
+
+size_t Queue::dequeue_n(void *const pv_buffer, size_t const item_count,
+                        delay_t const wait_time) {
+  return queue_receive_n(m_pHandle, static_cast<uint8_t *>(pv_buffer),
+                         m_itemLength, item_count, wait_time);
 }
 
 } // namespace RTOS
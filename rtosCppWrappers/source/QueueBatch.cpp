@@ -0,0 +1,134 @@
+/**
+ * @file        QueueBatch.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the batch transfer helpers for the queue wrappers.
+ * @version     0.1
+ * @date        2021-07-25
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "QueueBatch.hpp"
+
+namespace RTOS {
+
+namespace {
+/* Posts the items from first on with the ISR flavour, the caller masks the
+ * interrupts around it. */
+size_t send_masked(que_handle_t const handle, const uint8_t *const pItems,
+                   size_t const item_size, size_t const first,
+                   size_t const item_count, base_t &rYieldRequired) {
+  size_t sent = first;
+  while ((sent < item_count) &&
+         (xQueueSendToBackFromISR(handle, &pItems[sent * item_size],
+                                  &rYieldRequired) == pdTRUE)) {
+    ++sent;
+  }
+  return sent;
+}
+
+/* Receives the items from first on with the ISR flavour, the caller masks the
+ * interrupts around it. */
+size_t receive_masked(que_handle_t const handle, uint8_t *const pBuffer,
+                      size_t const item_size, size_t const first,
+                      size_t const item_count, base_t &rYieldRequired) {
+  size_t received = first;
+  while ((received < item_count) &&
+         (xQueueReceiveFromISR(handle, &pBuffer[received * item_size],
+                               &rYieldRequired) == pdTRUE)) {
+    ++received;
+  }
+  return received;
+}
+} // namespace
+
+size_t queue_send_n(que_handle_t const handle, const uint8_t *const pItems,
+                    size_t const item_size, size_t const item_count,
+                    delay_t const wait_time) {
+  size_t sent = 0U;
+  base_t isYieldRequired = pdFALSE;
+
+  /* Check if the method is called from a ISR. */
+  if (xPortIsInsideInterrupt() == pdTRUE) {
+
+    /* Cannot post to a queue with a blocking time from an ISR. */
+    if (wait_time.ticks() == 0U) {
+      UBaseType_t const savedMask = taskENTER_CRITICAL_FROM_ISR();
+      sent = send_masked(handle, pItems, item_size, 0U, item_count,
+                         isYieldRequired);
+      taskEXIT_CRITICAL_FROM_ISR(savedMask);
+
+      /* A single context switch for the whole batch. */
+      if (isYieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+  }
+
+  /* Call is not from an ISR use non ISR flavour. */
+  else if (item_count > 0U) {
+    /* Only the first item is allowed to block. */
+    if (xQueueSendToBack(handle, pItems, wait_time.ticks()) == pdTRUE) {
+
+      /* Rest of the batch in a single critical section, where only the ISR
+       * flavour of the api can be used. */
+      taskENTER_CRITICAL();
+      sent = send_masked(handle, pItems, item_size, 1U, item_count,
+                         isYieldRequired);
+      taskEXIT_CRITICAL();
+
+      /* A reader woken by the batch runs once it is all posted. */
+      if (isYieldRequired == pdTRUE) {
+        taskYIELD();
+      }
+    }
+  }
+  return sent;
+}
+
+size_t queue_receive_n(que_handle_t const handle, uint8_t *const pBuffer,
+                       size_t const item_size, size_t const item_count,
+                       delay_t const wait_time) {
+  size_t received = 0U;
+  base_t isYieldRequired = pdFALSE;
+
+  /* Check if the method is called from a ISR. */
+  if (xPortIsInsideInterrupt() == pdTRUE) {
+
+    /* Cannot receive from a queue with a blocking time from an ISR. */
+    if (wait_time.ticks() == 0U) {
+      UBaseType_t const savedMask = taskENTER_CRITICAL_FROM_ISR();
+      received = receive_masked(handle, pBuffer, item_size, 0U, item_count,
+                                isYieldRequired);
+      taskEXIT_CRITICAL_FROM_ISR(savedMask);
+
+      /* A single context switch for the whole batch. */
+      if (isYieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+  }
+
+  /* Call is not from an ISR use non ISR flavour. */
+  else if (item_count > 0U) {
+    /* Only the first item is allowed to block. */
+    if (xQueueReceive(handle, pBuffer, wait_time.ticks()) == pdTRUE) {
+
+      /* Rest of the batch in a single critical section, where only the ISR
+       * flavour of the api can be used. */
+      taskENTER_CRITICAL();
+      received = receive_masked(handle, pBuffer, item_size, 1U, item_count,
+                                isYieldRequired);
+      taskEXIT_CRITICAL();
+
+      /* A writer woken by the batch runs once it is all taken. */
+      if (isYieldRequired == pdTRUE) {
+        taskYIELD();
+      }
+    }
+  }
+  return received;
+}
+
+} // namespace RTOS
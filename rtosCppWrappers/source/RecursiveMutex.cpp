@@ -0,0 +1,89 @@
+/**
+ * @file      RecursiveMutex.cpp
+ * @author    Tummala Manish (manishtummala@gmail.com)
+ * @brief     Implements recursive mutex for FreeRTOS port.
+ * @version   0.1
+ * @date      30-07-2021
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "RecursiveMutex.hpp"
+#include "MemoryManager.hpp"
+
+#if configUSE_RECURSIVE_MUTEXES != 1
+#error "RTOS: RecursiveMutex needs configUSE_RECURSIVE_MUTEXES set to 1!!"
+#endif
+
+namespace RTOS {
+
+RecursiveMutex::RecursiveMutex()
+    : m_mutexHandle(nullptr), m_pMutexCB(nullptr), m_isMutexCreated(false) {
+  /* Try and get the control block from storage */
+  bool const isSuccessful = MemoryManager::get_Instance().get_CB(&m_pMutexCB) ==
+                            eMemoryResult::eMemAllocationSuccess;
+  if (isSuccessful) {
+    (void)create();
+  } else {
+    debug_break;
+  }
+}
+
+bool RecursiveMutex::create() {
+  /* If mutex is not yet created, then create one. */
+  if (!is_mutex_created() && (m_pMutexCB != nullptr)) {
+    m_mutexHandle = xSemaphoreCreateRecursiveMutexStatic(m_pMutexCB);
+    m_isMutexCreated = (m_mutexHandle != nullptr);
+  }
+  return m_isMutexCreated;
+}
+
+bool RecursiveMutex::lock(RTOS::delay_t timeOut) {
+
+  base_t ret_val = pdFALSE;
+  if (is_mutex_created()) {
+    /* The kernel has no ISR flavour of the recursive api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+      debug_break;
+    } else {
+      ret_val = xSemaphoreTakeRecursive(m_mutexHandle, timeOut.ticks());
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+bool RecursiveMutex::lock() { return lock(0); }
+
+bool RecursiveMutex::unlock() {
+
+  base_t ret_val = pdFALSE;
+  if (is_mutex_created()) {
+    /* The kernel has no ISR flavour of the recursive api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+      debug_break;
+    } else {
+      /* Fails if the calling thread is not the holder. */
+      ret_val = xSemaphoreGiveRecursive(m_mutexHandle);
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+bool RecursiveMutex::remove() {
+  bool isRemoved = false;
+  if (is_mutex_created()) {
+    /* A held mutex cannot be deleted, at any depth. */
+    if (xSemaphoreGetMutexHolder(m_mutexHandle) == nullptr) {
+      vSemaphoreDelete(m_mutexHandle);
+      m_mutexHandle = nullptr;
+      m_isMutexCreated = false;
+      isRemoved = true;
+    }
+  }
+  return isRemoved;
+}
+
+bool RecursiveMutex::is_mutex_created() const { return m_isMutexCreated; }
+
+} // namespace RTOS
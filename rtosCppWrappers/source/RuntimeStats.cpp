@@ -0,0 +1,88 @@
+/**
+ * @file        RuntimeStats.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Provides the CPU usage of the threads from the kernel run time
+ * statistics.
+ * @version     0.1
+ * @date        2021-07-28
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "RuntimeStats.hpp"
+
+namespace RTOS {
+
+#if configGENERATE_RUN_TIME_STATS == 1
+namespace {
+uint8_t load_percent(uint32_t const run_time, uint32_t const total_run_time) {
+  /* Same integer only scaling as vTaskGetRunTimeStats. */
+  uint32_t const one_percent = total_run_time / 100U;
+  uint32_t const percent = (one_percent > 0U) ? (run_time / one_percent) : 0U;
+  return static_cast<uint8_t>(percent > 100U ? 100U : percent);
+}
+
+uint32_t context_switches(thr_handle_t const handle) {
+  return static_cast<uint32_t>(
+      reinterpret_cast<uintptr_t>(pvTaskGetThreadLocalStoragePointer(
+          handle, configRUN_TIME_SWITCH_COUNT_INDEX)));
+}
+} // namespace
+
+uint32_t get_total_run_time() { return portGET_RUN_TIME_COUNTER_VALUE(); }
+
+runtime_stats_s get_runtime_stats(thr_handle_t const handle) {
+  runtime_stats_s stats = {};
+  if (handle != nullptr) {
+    TaskStatus_t status;
+    vTaskGetInfo(handle, &status, pdFALSE, eInvalid);
+
+    stats.run_time = status.ulRunTimeCounter;
+    stats.load_percent = load_percent(stats.run_time, get_total_run_time());
+    stats.context_switches = context_switches(handle);
+  }
+  return stats;
+}
+
+size_t capture_runtime_stats(TaskStatus_t *const pTaskStatus,
+                             thread_runtime_s *const pThreads,
+                             size_t const count, uint32_t &rTotalRunTime) {
+  uint32_t total_run_time = 0U;
+  auto const thread_count = static_cast<size_t>(uxTaskGetSystemState(
+      pTaskStatus, static_cast<UBaseType_t>(count), &total_run_time));
+
+  for (size_t index = 0U; index < thread_count; ++index) {
+    TaskStatus_t const &rStatus = pTaskStatus[index];
+    pThreads[index].name = rStatus.pcTaskName;
+    pThreads[index].handle = rStatus.xHandle;
+    pThreads[index].stats.run_time = rStatus.ulRunTimeCounter;
+    pThreads[index].stats.load_percent =
+        load_percent(rStatus.ulRunTimeCounter, total_run_time);
+    pThreads[index].stats.context_switches = context_switches(rStatus.xHandle);
+  }
+  rTotalRunTime = total_run_time;
+  return thread_count;
+}
+
+#else
+/* Run time stats are not generated by the kernel, all the figures are 0. */
+uint32_t get_total_run_time() { return 0U; }
+
+runtime_stats_s get_runtime_stats(thr_handle_t const handle) {
+  (void)handle;
+  return runtime_stats_s{};
+}
+
+size_t capture_runtime_stats(TaskStatus_t *const pTaskStatus,
+                             thread_runtime_s *const pThreads,
+                             size_t const count, uint32_t &rTotalRunTime) {
+  (void)pTaskStatus;
+  (void)pThreads;
+  (void)count;
+  rTotalRunTime = 0U;
+  return 0U;
+}
+#endif // configGENERATE_RUN_TIME_STATS == 1
+
+} // namespace RTOS
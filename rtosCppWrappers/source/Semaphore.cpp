@@ -0,0 +1,105 @@
+/**
+ * @file        Semaphore.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the counting and the binary semaphores.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "Semaphore.hpp"
+
+#if configUSE_COUNTING_SEMAPHORES != 1
+#error "RTOS: CountingSemaphore needs configUSE_COUNTING_SEMAPHORES set to 1!!"
+#endif
+
+namespace RTOS {
+
+Semaphore::~Semaphore() {
+  if (m_handle != nullptr) {
+    vSemaphoreDelete(m_handle);
+  }
+}
+
+bool Semaphore::try_acquire_for(delay_t const timeout) {
+
+  base_t ret_val = pdFALSE;
+  if (is_created()) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xSemaphoreTakeFromISR(m_handle, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xSemaphoreTake(m_handle, timeout.ticks());
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+bool Semaphore::release() {
+
+  base_t ret_val = pdFALSE;
+  if (is_created()) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xSemaphoreGiveFromISR(m_handle, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xSemaphoreGive(m_handle);
+    }
+  }
+  return ret_val == pdTRUE;
+}
+
+semaphore_count_t Semaphore::get_count() const {
+  semaphore_count_t count = 0U;
+  if (is_created()) {
+    count = (xPortIsInsideInterrupt() == pdTRUE)
+                ? uxQueueMessagesWaitingFromISR(m_handle)
+                : uxSemaphoreGetCount(m_handle);
+  }
+  return count;
+}
+
+CountingSemaphore::CountingSemaphore(semaphore_count_t const max_count,
+                                     semaphore_count_t const initial_count) {
+  /* The kernel asserts on these, fail early with a clear break instead. */
+  if ((max_count == 0U) || (initial_count > max_count)) {
+    debug_break;
+  } else {
+    m_handle = xSemaphoreCreateCountingStatic(max_count, initial_count,
+                                              &m_semaphoreCB);
+  }
+}
+
+BinarySemaphore::BinarySemaphore(bool const isAvailable) {
+  /* Binary semaphores are created empty. */
+  m_handle = xSemaphoreCreateBinaryStatic(&m_semaphoreCB);
+  if ((m_handle != nullptr) && isAvailable) {
+    (void)xSemaphoreGive(m_handle);
+  }
+}
+
+} // namespace RTOS
@@ -0,0 +1,74 @@
+/**
+ * @file        StackMonitor.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the thread that watches the stack usage of all the
+ * registered threads.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "StackMonitor.hpp"
+
+namespace RTOS {
+
+StackMonitor::StackMonitor(delay_t const period, stack_size_t const threshold,
+                           callback_t const pCallback, void *const pContext,
+                           priority_t const priority,
+                           stack_size_t const stack_size)
+    : PeriodicThread("StackMon", priority, stack_size, period),
+      m_threshold(threshold), m_pCallback(pCallback), m_pContext(pContext),
+      m_samples() {}
+
+stack_size_t StackMonitor::get_min_headroom(Thread const &rThread) const {
+  stack_size_t headroom = rThread.get_stack_size();
+  for (sample_s const &rSample : m_samples) {
+    if ((rSample.pThread == &rThread) && (rSample.min_headroom < headroom)) {
+      headroom = rSample.min_headroom;
+    }
+  }
+  return headroom;
+}
+
+void StackMonitor::run_period() {
+  ThreadRegistry const &rRegistry = ThreadRegistry::get_Instance();
+
+  for (size_t slot = 0U; slot < ThreadRegistry::MAX_THREADS; ++slot) {
+    Thread *pLowThread = nullptr;
+    stack_size_t headroom = 0U;
+
+    /* The thread cannot be destroyed while it is being sampled. */
+    vTaskSuspendAll();
+    Thread *const pThread = rRegistry.at(slot);
+    sample_s &rSample = m_samples[slot];
+
+    /* The slot got a new thread since the last sample. */
+    if (rSample.pThread != pThread) {
+      rSample.pThread = pThread;
+      rSample.min_headroom =
+          (pThread != nullptr) ? pThread->get_stack_size() : 0U;
+      rSample.is_reported = false;
+    }
+
+    if ((pThread != nullptr) && pThread->is_thread_created()) {
+      headroom = pThread->get_stack_headroom();
+      if (headroom < rSample.min_headroom) {
+        rSample.min_headroom = headroom;
+      }
+      if ((headroom < m_threshold) && !rSample.is_reported) {
+        rSample.is_reported = true;
+        pLowThread = pThread;
+      }
+    }
+    (void)xTaskResumeAll();
+
+    /* The callback is free to block, so it is called outside. */
+    if ((pLowThread != nullptr) && (m_pCallback != nullptr)) {
+      m_pCallback(*pLowThread, headroom, m_pContext);
+    }
+  }
+}
+
+} // namespace RTOS
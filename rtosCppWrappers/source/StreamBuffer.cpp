@@ -0,0 +1,108 @@
+/**
+ * @file        StreamBuffer.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the stream and the message buffers for byte I/O.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "StreamBuffer.hpp"
+
+namespace RTOS {
+
+ByteBuffer::ByteBuffer(uint8_t *const pStorage, size_t const size,
+                       size_t const trigger_level,
+                       StaticStreamBuffer_t *const pBufferCB,
+                       bool const isMessageBuffer)
+    : m_handle(nullptr) {
+  if (isMessageBuffer) {
+    m_handle = xMessageBufferCreateStatic(size, pStorage, pBufferCB);
+  } else if ((trigger_level > 0U) && (trigger_level < size)) {
+    m_handle =
+        xStreamBufferCreateStatic(size, trigger_level, pStorage, pBufferCB);
+  } else {
+    /* The size counts the free byte, a level above the usable bytes would
+     * never wake the reader. */
+    debug_break;
+  }
+}
+
+ByteBuffer::~ByteBuffer() {
+  if (m_handle != nullptr) {
+    vStreamBufferDelete(m_handle);
+  }
+}
+
+bool ByteBuffer::is_empty() const {
+  return !is_created() || (xStreamBufferIsEmpty(m_handle) == pdTRUE);
+}
+
+bool ByteBuffer::is_full() const {
+  return is_created() && (xStreamBufferIsFull(m_handle) == pdTRUE);
+}
+
+size_t ByteBuffer::space() const {
+  return is_created() ? xStreamBufferSpacesAvailable(m_handle) : 0U;
+}
+
+bool ByteBuffer::reset() {
+  return is_created() && (xStreamBufferReset(m_handle) == pdPASS);
+}
+
+size_t ByteBuffer::send_bytes(void const *const pData, size_t const size,
+                              delay_t const timeout) {
+
+  size_t sent = 0U;
+  if (is_created()) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      sent = xStreamBufferSendFromISR(m_handle, pData, size, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      sent = xStreamBufferSend(m_handle, pData, size, timeout.ticks());
+    }
+  }
+  return sent;
+}
+
+size_t ByteBuffer::receive_bytes(void *const pData, size_t const size,
+                                 delay_t const timeout) {
+
+  size_t received = 0U;
+  if (is_created()) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      received =
+          xStreamBufferReceiveFromISR(m_handle, pData, size, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      received = xStreamBufferReceive(m_handle, pData, size, timeout.ticks());
+    }
+  }
+  return received;
+}
+
+} // namespace RTOS
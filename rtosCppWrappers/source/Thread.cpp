@@ -11,6 +11,11 @@
 
 #include "Thread.hpp"
 #include "MemoryManager.hpp"
+#include "ThreadRegistry.hpp"
+
+#if (SYSTEM_VIEW_ANALYSIS == 1) && defined(SIM)
+#include "sysviewPostMortem.h"
+#endif
 
 namespace RTOS {
 
@@ -54,28 +59,40 @@ struct TCB_pass_s {
     m_stackSize = thread_stack_size;
     m_threadPrio = thread_priority;
 
-    for (size_t index = static_cast<size_t>(0); index < configMAX_TASK_NAME_LEN;
-         ++index) {
+    // Truncated like the kernel does, so the name always ends with a 0.
+    size_t index = static_cast<size_t>(0);
+    for (; index < (configMAX_TASK_NAME_LEN - 1U); ++index) {
       if (thread_name[index] != static_cast<char>(0x00)) {
         m_threadName[index] = thread_name[index];
       } else {
         // End of the thread-name reached.
-        m_threadName[index] = static_cast<char>(0x00);
         break;
       }
     }
+    m_threadName[index] = static_cast<char>(0x00);
   }
 };
 
 using TCB_PASS_STR = struct TCB_pass_s;
 
-/*--------- static value initialization ---------*/
-id_t Thread::m_sThreadCount = 0;
-/*----------------------------------------------*/
+namespace {
+/* Set by end_scheduler(), the kernel reports an ended scheduler as not
+ * started. */
+bool s_isSchedulerEnded = false;
+} // namespace
 
 RTOS::Thread::Thread(const name_t thread_name, const priority_t thread_priority,
-                     const stack_size_t thread_stack_size, const id_t thread_id)
-    : m_pStack(nullptr), m_pTaskCb(nullptr), m_pHandle(nullptr) {
+                     stack_size_t thread_stack_size, const id_t thread_id)
+    : m_threadId(ThreadRegistry::INVALID_ID), m_pStack(nullptr),
+      m_pTaskCb(nullptr), m_stackSize(0U), m_pHandle(nullptr),
+      m_isStorageOwned(true) {
+
+#ifdef POSIX_SIM
+  /* The pthread backing the task cannot run on a stack below the minimal. */
+  if (thread_stack_size < configMINIMAL_STACK_SIZE) {
+    thread_stack_size = configMINIMAL_STACK_SIZE;
+  }
+#endif
 
   /* Try and get a TCB block from the RTOS memory region successfully. */
   bool result = ((MemoryManager::get_Instance().get_CB(&m_pTaskCb) ==
@@ -87,20 +104,7 @@ RTOS::Thread::Thread(const name_t thread_name, const priority_t thread_priority,
 
   /* If both the allocations are successful then fill the thread variables. */
   if (result) {
-    m_threadStatus = THR_STA_E::eNotStarted;
-
-    /* Casting TCB to a intermediate type to pass task parameters. */
-    (*(reinterpret_cast<TCB_PASS_STR *>(m_pTaskCb)))
-        .fill_tcb_from_args(thread_name, thread_priority, thread_stack_size,
-                            m_pStack);
-
-    /* TODO: Write the feature for thread ID */
-    m_sThreadCount++;
-    if (thread_id != 0) {
-      m_threadId = thread_id;
-    } else {
-      m_threadId = m_sThreadCount;
-    }
+    prepare(thread_name, thread_priority, thread_stack_size, thread_id);
 
     /* If the creation has failed release the TCB if allocated. */
   } else {
@@ -117,13 +121,44 @@ RTOS::Thread::Thread(const name_t thread_name, const priority_t thread_priority,
   }
 }
 
+RTOS::Thread::Thread(const name_t thread_name, const priority_t thread_priority,
+                     const stack_size_t thread_stack_size, const stack_t stack,
+                     const control_block_t task_cb, const id_t thread_id)
+    : m_threadId(ThreadRegistry::INVALID_ID), m_pStack(stack),
+      m_pTaskCb(task_cb), m_stackSize(0U), m_pHandle(nullptr),
+      m_isStorageOwned(false) {
+
+  /* Storage is handed in by the owner so nothing can fail here. */
+  prepare(thread_name, thread_priority, thread_stack_size, thread_id);
+}
+
+void Thread::prepare(const name_t thread_name, const priority_t thread_priority,
+                     const stack_size_t thread_stack_size,
+                     const id_t thread_id) {
+  m_threadStatus = THR_STA_E::eNotStarted;
+  m_stackSize = thread_stack_size;
+
+  /* Casting TCB to a intermediate type to pass task parameters. */
+  (*(reinterpret_cast<TCB_PASS_STR *>(m_pTaskCb)))
+      .fill_tcb_from_args(thread_name, thread_priority, thread_stack_size,
+                          m_pStack);
+
+  /* The registry hands out the id, a full registry leaves the id invalid. */
+  m_threadId = ThreadRegistry::get_Instance().add(*this, thread_name,
+                                                  thread_priority, thread_id);
+}
+
 Thread::~Thread() {
+  ThreadRegistry::get_Instance().remove(m_threadId);
+
   if (is_scheduler_running()) {
     vTaskDelete(m_pHandle);
   }
   /* Release the resources block by the thread. */
-  MemoryManager::release_CB(m_pTaskCb);
-  MemoryManager::release_stack(m_pStack);
+  if (m_isStorageOwned) {
+    MemoryManager::release_CB(m_pTaskCb);
+    MemoryManager::release_stack(m_pStack);
+  }
 }
 
 void Thread::start(void *super) {
@@ -149,6 +184,8 @@ void Thread::start(void *super) {
   }
 }
 
+bool Thread::is_scheduler_ended() { return s_isSchedulerEnded; }
+
 bool Thread::is_scheduler_running() {
   return xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
 }
@@ -168,7 +205,7 @@ RET_STA_E Thread::wait_for_notification(uint32_t entryClearMask,
                                         uint32_t exitClearMask, delay_t msDelay,
                                         uint32_t *pNotificationValue) {
   auto ret_val = xTaskNotifyWait(entryClearMask, exitClearMask,
-                                 pNotificationValue, pdMS_TO_TICKS(msDelay));
+                                 pNotificationValue, msDelay.ticks());
   return ret_val == pdTRUE ? RET_STA_E::eRTOSSuccess : RET_STA_E::eRTOSFailure;
 }
 
@@ -180,7 +217,7 @@ Thread::SIG_RET_VAL Thread::wait_for_signal_on_bits(uint32_t signalMask,
 
   /* Wait until the timeout expires or a notification is received. */
   auto time_out_status = xTaskNotifyWait(
-      signalMask, signalMask, &notification_value, pdMS_TO_TICKS(blockTime));
+      signalMask, signalMask, &notification_value, blockTime.ticks());
 
   /* Clear unwanted bits of the received notification. */
   uint32_t received_signal = notification_value & signalMask;
@@ -209,9 +246,9 @@ Thread::NTF_VALUE_S Thread::wait_for_value(delay_t blockTime) {
   Thread::NTF_VALUE_S ret_value = {true, static_cast<uint32_t>(0x00)};
 
   /* Wait until the timeout expires or a value over notification is received. */
-  auto time_out_status =
-      xTaskNotifyWait(static_cast<uint32_t>(0x00), pdMS_TO_TICKS(wait_forever),
-                      &(ret_value.received_value), pdMS_TO_TICKS(blockTime));
+  auto time_out_status = xTaskNotifyWait(
+      static_cast<uint32_t>(0x00), static_cast<uint32_t>(0xFFFFFFFFUL),
+      &(ret_value.received_value), blockTime.ticks());
 
   /* Check if the unblocking is due to timeout or a value is received. */
   if (time_out_status == pdPASS) {
@@ -233,10 +270,22 @@ uint32_t Thread::SIG_BIT(const unsigned int value) {
 }
 
 void Thread::delay_ms(delay_t delay) {
-  vTaskDelay(static_cast<TickType_t>(pdMS_TO_TICKS(delay)));
+  vTaskDelay(delay.ticks());
 }
 
-void Thread::end_scheduler() { vTaskEndScheduler(); }
+bool Thread::delay_until(TickType_t &rLastWakeTime, delay_t const period) {
+  return xTaskDelayUntil(&rLastWakeTime, period.ticks()) == pdTRUE;
+}
+
+void Thread::end_scheduler() {
+#if (SYSTEM_VIEW_ANALYSIS == 1) && defined(SIM)
+  // The scheduler does not return here on the simulators, so the trace is
+  // saved before it ends.
+  vSysViewDumpTrace();
+#endif
+  s_isSchedulerEnded = true;
+  vTaskEndScheduler();
+}
 
 priority_t Thread::get_priority() const {
   return static_cast<priority_t>(uxTaskPriorityGet(m_pHandle));
@@ -246,15 +295,42 @@ priority_t Thread::get_priority() const {
 return_status_e Thread::set_priority(priority_t new_priority) {
   // TODO: This is a bit complicated function has to be implement yet.
   vTaskPrioritySet(m_pHandle, new_priority);
+  ThreadRegistry::get_Instance().set_priority(m_threadId, new_priority);
   return RET_STA_E::eRTOSSuccess;
 }
 
 char const *Thread::get_name() const {
-  return static_cast<const char *>(pcTaskGetName(m_pHandle));
+  char const *pName = "";
+
+  /* The name is kept in the TCB of this thread, never in shared storage, so it
+   * does not change while the thread exists. */
+  if (m_pHandle != nullptr) {
+    pName = static_cast<const char *>(pcTaskGetName(m_pHandle));
+  }
+  /* Not joined yet, the name waits in the TCB for the kernel. */
+  else if (m_threadStatus != THR_STA_E::eMemoryAllocationFailed) {
+    pName = reinterpret_cast<TCB_PASS_STR const *>(m_pTaskCb)->m_threadName;
+  }
+  return pName;
 }
 
 status_e Thread::get_status() const { return m_threadStatus; }
 
+runtime_stats_s Thread::get_runtime_stats() const {
+  return RTOS::get_runtime_stats(m_pHandle);
+}
+
+stack_size_t Thread::get_stack_size() const { return m_stackSize; }
+
+stack_size_t Thread::get_stack_headroom() const {
+  stack_size_t headroom = 0U;
+  if (m_pHandle != nullptr) {
+    headroom =
+        static_cast<stack_size_t>(uxTaskGetStackHighWaterMark(m_pHandle));
+  }
+  return headroom;
+}
+
 void Thread::suspend() {
 
   /* Change the status of the thread before calling the api. */
@@ -298,6 +374,7 @@ void Thread::join() {
                                   (void *const)(this), dest.m_threadPrio,
                                   dest.m_pStack, m_pTaskCb);
     if (m_pHandle != nullptr) {
+      ThreadRegistry::get_Instance().set_handle(m_threadId, m_pHandle);
       /*If thread creation is successful start the scheduler.*/
       start_scheduler();
     } else {
@@ -421,10 +498,24 @@ extern "C" void
 vApplicationGetIdleTaskMemory(StaticTask_t **const ppxIdleTaskTCBBuffer,
                               StackType_t **const ppxIdleTaskStackBuffer,
                               uint32_t *const pulIdleTaskStackSize) {
-  constexpr unsigned int stack_size = 50;
+  constexpr unsigned int stack_size = configMINIMAL_STACK_SIZE;
   static StaticTask_t l_tcb;
   static StackType_t l_stack[stack_size];
   *pulIdleTaskStackSize = stack_size;
   *ppxIdleTaskStackBuffer = reinterpret_cast<StackType_t *>(&l_stack);
   *ppxIdleTaskTCBBuffer = &l_tcb;
 }
+
+#if configUSE_TIMERS == 1
+extern "C" void
+vApplicationGetTimerTaskMemory(StaticTask_t **const ppxTimerTaskTCBBuffer,
+                               StackType_t **const ppxTimerTaskStackBuffer,
+                               uint32_t *const pulTimerTaskStackSize) {
+  constexpr unsigned int stack_size = configTIMER_TASK_STACK_DEPTH;
+  static StaticTask_t l_tcb;
+  static StackType_t l_stack[stack_size];
+  *pulTimerTaskStackSize = stack_size;
+  *ppxTimerTaskStackBuffer = reinterpret_cast<StackType_t *>(&l_stack);
+  *ppxTimerTaskTCBBuffer = &l_tcb;
+}
+#endif
@@ -0,0 +1,227 @@
+/**
+ * @file        ThreadRegistry.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the registry that keeps track of all the threads.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "ThreadRegistry.hpp"
+
+namespace RTOS {
+
+namespace {
+/* Stored names are truncated to this length like the kernel does. */
+constexpr size_t MAX_NAME_LENGTH = configMAX_TASK_NAME_LEN - 1U;
+} // namespace
+
+/*--------- static value initialization ---------*/
+ThreadRegistry ThreadRegistry::m_rThreadRegistry;
+/*----------------------------------------------*/
+
+ThreadRegistry &ThreadRegistry::get_Instance() { return m_rThreadRegistry; }
+
+uint32_t ThreadRegistry::hash_name(name_t const name) {
+  uint32_t hash = 2166136261UL;
+  if (name != nullptr) {
+    for (size_t index = 0U;
+         (index < MAX_NAME_LENGTH) && (name[index] != static_cast<char>(0x00));
+         ++index) {
+      hash ^= static_cast<uint8_t>(name[index]);
+      hash *= 16777619UL;
+    }
+  }
+  return hash;
+}
+
+bool ThreadRegistry::is_same_name(char const *const pStored,
+                                  name_t const name) {
+  bool isSame = true;
+  for (size_t index = 0U; index < MAX_NAME_LENGTH; ++index) {
+    char const expected =
+        (name != nullptr) ? name[index] : static_cast<char>(0x00);
+    if (pStored[index] != expected) {
+      isSame = false;
+      break;
+    }
+    if (expected == static_cast<char>(0x00)) {
+      break;
+    }
+  }
+  return isSame;
+}
+
+id_t ThreadRegistry::take_id(id_t const requested_id) {
+  id_t id = INVALID_ID;
+
+  bool const isRequestedFree =
+      (requested_id != INVALID_ID) && (requested_id <= MAX_THREADS) &&
+      (m_entries[requested_id - 1U].pThread == nullptr);
+
+  if (isRequestedFree) {
+    id = requested_id;
+    /* The ids skipped on the way to a never used id become free. */
+    if (id > m_usedIdCount) {
+      for (auto skipped = static_cast<id_t>(m_usedIdCount + 1U); skipped < id;
+           ++skipped) {
+        m_nextId[skipped - 1U] = m_freeHead;
+        m_freeHead = skipped;
+      }
+      m_usedIdCount = id;
+    }
+    /* Else it is a released id that has to be taken out of the free list. */
+    else {
+      id_t *pLink = &m_freeHead;
+      while (*pLink != id) {
+        pLink = &m_nextId[*pLink - 1U];
+      }
+      *pLink = m_nextId[id - 1U];
+    }
+  }
+  /* Released ids are handed out first. */
+  else if (m_freeHead != INVALID_ID) {
+    id = m_freeHead;
+    m_freeHead = m_nextId[id - 1U];
+  }
+  /* Else the next id that was never used. */
+  else if (m_usedIdCount < MAX_THREADS) {
+    ++m_usedIdCount;
+    id = static_cast<id_t>(m_usedIdCount);
+  }
+  return id;
+}
+
+Thread *ThreadRegistry::thread_of(id_t const id) const {
+  return ((id != INVALID_ID) && (id <= MAX_THREADS))
+             ? m_entries[id - 1U].pThread
+             : nullptr;
+}
+
+void ThreadRegistry::unlink_name(id_t const id) {
+  size_t const bucket =
+      hash_name(m_entries[id - 1U].name) & (NAME_BUCKETS - 1U);
+  id_t *pLink = &m_bucketHead[bucket];
+  while ((*pLink != INVALID_ID) && (*pLink != id)) {
+    pLink = &m_nextId[*pLink - 1U];
+  }
+  if (*pLink == id) {
+    *pLink = m_nextId[id - 1U];
+  }
+}
+
+id_t ThreadRegistry::add(Thread &rThread, name_t const name,
+                         priority_t const priority, id_t const requested_id) {
+  size_t const bucket = hash_name(name) & (NAME_BUCKETS - 1U);
+
+  taskENTER_CRITICAL();
+  id_t const id = take_id(requested_id);
+  if (id != INVALID_ID) {
+    thread_entry_s &rEntry = m_entries[id - 1U];
+    rEntry.pThread = &rThread;
+    rEntry.handle = nullptr;
+    rEntry.priority = priority;
+
+    size_t length = 0U;
+    while ((name != nullptr) && (length < MAX_NAME_LENGTH) &&
+           (name[length] != static_cast<char>(0x00))) {
+      rEntry.name[length] = name[length];
+      ++length;
+    }
+    rEntry.name[length] = static_cast<char>(0x00);
+
+    /* Newest thread goes to the front of its bucket. */
+    m_nextId[id - 1U] = m_bucketHead[bucket];
+    m_bucketHead[bucket] = id;
+    ++m_threadCount;
+  }
+  taskEXIT_CRITICAL();
+
+  return id;
+}
+
+void ThreadRegistry::remove(id_t const id) {
+  taskENTER_CRITICAL();
+  if (thread_of(id) != nullptr) {
+    unlink_name(id);
+    m_entries[id - 1U] = thread_entry_s();
+
+    /* The id is handed out again. */
+    m_nextId[id - 1U] = m_freeHead;
+    m_freeHead = id;
+    --m_threadCount;
+  }
+  taskEXIT_CRITICAL();
+}
+
+void ThreadRegistry::set_handle(id_t const id, thr_handle_t const handle) {
+  taskENTER_CRITICAL();
+  if (thread_of(id) != nullptr) {
+    m_entries[id - 1U].handle = handle;
+  }
+  taskEXIT_CRITICAL();
+}
+
+void ThreadRegistry::set_priority(id_t const id, priority_t const priority) {
+  taskENTER_CRITICAL();
+  if (thread_of(id) != nullptr) {
+    m_entries[id - 1U].priority = priority;
+  }
+  taskEXIT_CRITICAL();
+}
+
+Thread *ThreadRegistry::find(id_t const id) const {
+  taskENTER_CRITICAL();
+  Thread *const pThread = thread_of(id);
+  taskEXIT_CRITICAL();
+
+  return pThread;
+}
+
+Thread *ThreadRegistry::find(name_t const name) const {
+  Thread *pThread = nullptr;
+  size_t const bucket = hash_name(name) & (NAME_BUCKETS - 1U);
+
+  taskENTER_CRITICAL();
+  for (id_t id = m_bucketHead[bucket]; id != INVALID_ID;
+       id = m_nextId[id - 1U]) {
+    if (is_same_name(m_entries[id - 1U].name, name)) {
+      pThread = m_entries[id - 1U].pThread;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+
+  return pThread;
+}
+
+bool ThreadRegistry::get_entry(id_t const id, thread_entry_s &rEntry) const {
+  bool isFound = false;
+
+  taskENTER_CRITICAL();
+  if (thread_of(id) != nullptr) {
+    rEntry = m_entries[id - 1U];
+    isFound = true;
+  }
+  taskEXIT_CRITICAL();
+
+  return isFound;
+}
+
+Thread *ThreadRegistry::at(size_t const slot) const {
+  Thread *pThread = nullptr;
+
+  taskENTER_CRITICAL();
+  if (slot < MAX_THREADS) {
+    pThread = m_entries[slot].pThread;
+  }
+  taskEXIT_CRITICAL();
+
+  return pThread;
+}
+
+size_t ThreadRegistry::count() const { return m_threadCount; }
+
+} // namespace RTOS
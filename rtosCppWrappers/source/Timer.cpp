@@ -0,0 +1,214 @@
+/**
+ * @file        Timer.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the software timer run by the timer daemon.
+ * @version     0.1
+ * @date        2021-07-31
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "Timer.hpp"
+#include "Semaphore.hpp"
+#include "Thread.hpp"
+
+namespace RTOS {
+
+namespace {
+/* Runs in the daemon after all the commands posted before it. */
+void release_waiter(void *const pWaiter, uint32_t const unused) {
+  (void)unused;
+  (void)static_cast<BinarySemaphore *>(pWaiter)->release();
+}
+} // namespace
+
+Timer::Timer(name_t const timer_name, delay_t const period,
+             timer_mode_e const mode, callback_t const callback,
+             void *const pContext)
+    : Timer(timer_name, period, mode) {
+  m_callback = callback;
+  m_pContext = pContext;
+  if (callback == nullptr) {
+    debug_break;
+  }
+}
+
+Timer::Timer(name_t const timer_name, delay_t const period,
+             timer_mode_e const mode)
+    : m_timerCB(), m_handle(nullptr), m_callback(nullptr),
+      m_pContext(nullptr) {
+  /* The kernel asserts on a period of 0 ticks. */
+  if (period.ticks() == 0U) {
+    debug_break;
+  } else {
+    m_handle = xTimerCreateStatic(
+        timer_name, period.ticks(),
+        (mode == timer_mode_e::eAutoReload) ? pdTRUE : pdFALSE,
+        static_cast<void *>(this), expiry_callback, &m_timerCB);
+  }
+}
+
+Timer::~Timer() { release(); }
+
+void Timer::release() {
+  if (m_handle == nullptr) {
+    return;
+  }
+
+  bool const isRunning = Thread::is_scheduler_running();
+
+  /* An ended scheduler never runs the daemon again, nothing refers to the
+   * control block any more. */
+  if (!isRunning && Thread::is_scheduler_ended()) {
+    m_handle = nullptr;
+    return;
+  }
+
+  /* The delete is only a command to the daemon. Before the scheduler runs, or
+   * from the daemon itself, the command runs after this object is gone and
+   * the daemon writes to the destroyed control block. The destruction is
+   * refused and the timer is left to the kernel. */
+  if (!isRunning ||
+      (xTaskGetCurrentTaskHandle() == xTimerGetTimerDaemonTaskHandle())) {
+    debug_break;
+    return;
+  }
+
+  if (xTimerDelete(m_handle, wait_forever.ticks()) != pdPASS) {
+    /* The daemon would run the expiry on a destroyed object. */
+    debug_break;
+    return;
+  }
+
+  /* The daemon still refers to the control block till it runs the delete,
+   * which is before any function pended after it. */
+  BinarySemaphore waiter;
+  if (xTimerPendFunctionCall(release_waiter, &waiter, 0U,
+                             wait_forever.ticks()) == pdPASS) {
+    (void)waiter.acquire();
+  }
+  m_handle = nullptr;
+}
+
+bool Timer::start(delay_t const timeout) {
+
+  base_t ret_val = pdFALSE;
+  if (m_handle != nullptr) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xTimerStartFromISR(m_handle, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xTimerStart(m_handle, timeout.ticks());
+    }
+  }
+  return ret_val == pdPASS;
+}
+
+bool Timer::stop(delay_t const timeout) {
+
+  base_t ret_val = pdFALSE;
+  if (m_handle != nullptr) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xTimerStopFromISR(m_handle, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xTimerStop(m_handle, timeout.ticks());
+    }
+  }
+  return ret_val == pdPASS;
+}
+
+bool Timer::reset(delay_t const timeout) {
+
+  base_t ret_val = pdFALSE;
+  if (m_handle != nullptr) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val = xTimerResetFromISR(m_handle, &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xTimerReset(m_handle, timeout.ticks());
+    }
+  }
+  return ret_val == pdPASS;
+}
+
+bool Timer::change_period(delay_t const period, delay_t const timeout) {
+
+  base_t ret_val = pdFALSE;
+  if ((m_handle != nullptr) && (period.ticks() != 0U)) {
+    /* If the call is made from a ISR or Application and call relv. api. */
+    if (xPortIsInsideInterrupt() == pdTRUE) {
+
+      /* Check if a context switch is required. */
+      base_t YieldRequired = 0U;
+      ret_val =
+          xTimerChangePeriodFromISR(m_handle, period.ticks(), &YieldRequired);
+
+      /* Perform a switch if required. */
+      if (YieldRequired == pdTRUE) {
+        portYIELD();
+      }
+    }
+
+    /* Not in an ISR so using normal flavour if the api. */
+    else {
+      ret_val = xTimerChangePeriod(m_handle, period.ticks(), timeout.ticks());
+    }
+  }
+  return ret_val == pdPASS;
+}
+
+bool Timer::is_active() const {
+  return (m_handle != nullptr) && (xTimerIsTimerActive(m_handle) != pdFALSE);
+}
+
+delay_t Timer::get_period() const {
+  return delay_t::from_ticks((m_handle != nullptr) ? xTimerGetPeriod(m_handle)
+                                                   : 0U);
+}
+
+void Timer::on_expiry() {
+  if (m_callback != nullptr) {
+    m_callback(*this, m_pContext);
+  }
+}
+
+void Timer::expiry_callback(TimerHandle_t const handle) {
+  static_cast<Timer *>(pvTimerGetTimerID(handle))->on_expiry();
+}
+
+} // namespace RTOS
@@ -0,0 +1,94 @@
+/**
+ * @file        WorkQueue.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Implements the executor that runs short jobs on a few shared
+ * worker threads.
+ * @version     0.1
+ * @date        2021-08-03
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "WorkQueue.hpp"
+
+namespace RTOS {
+
+WorkQueueBase::WorkQueueBase(
+    IQueueSender *const (&pSenders)[JOB_PRIORITY_LEVELS],
+    IQueueReceiver *const (&pReceivers)[JOB_PRIORITY_LEVELS],
+    size_t const depth)
+    : m_pSenders{pSenders[0], pSenders[1], pSenders[2]},
+      m_pReceivers{pReceivers[0], pReceivers[1], pReceivers[2]},
+      m_pending(static_cast<semaphore_count_t>(depth * JOB_PRIORITY_LEVELS)),
+      m_completed(0U), m_rejected(0U) {
+
+  /* The workers would wait forever on a semaphore that was not created. */
+  if (!m_pending.is_created()) {
+    debug_break;
+  }
+}
+
+bool WorkQueueBase::submit(Job const &rJob, job_priority_e const priority,
+                           delay_t const timeout) {
+  size_t const level = static_cast<size_t>(priority);
+  if (level >= JOB_PRIORITY_LEVELS) {
+    debug_break;
+    return false;
+  }
+
+  /* The queue checks for an ISR, from an ISR a full queue fails at once. */
+  if (m_pSenders[level]->enqueue(&rJob, timeout) != RET_STA_E::eRTOSSuccess) {
+    (void)m_rejected.fetch_add(1U, std::memory_order_relaxed);
+    return false;
+  }
+
+  /* Given after the job is queued so a worker never wakes up to nothing. The
+   * count holds every job, so the give cannot fail. */
+  (void)m_pending.release();
+  return true;
+}
+
+void WorkQueueBase::serve() {
+  for (;;) {
+    if (!m_pending.acquire()) {
+      continue;
+    }
+
+    /* The highest priority first, the semaphore guarantees a job. */
+    Job job;
+    for (IQueueReceiver *const pReceiver : m_pReceivers) {
+      if (pReceiver->dequeue(&job, delay_t(0U)) == RET_STA_E::eRTOSSuccess) {
+        break;
+      }
+    }
+    job();
+    (void)m_completed.fetch_add(1U, std::memory_order_relaxed);
+  }
+}
+
+WorkQueueBase::worker_name_s
+WorkQueueBase::make_worker_name(name_t const name, size_t index) {
+  worker_name_s workerName{};
+  char digits[20];
+  size_t digitCount = 0U;
+  do {
+    digits[digitCount++] = static_cast<char>('0' + (index % 10U));
+    index /= 10U;
+  } while (index != 0U);
+
+  /* The name of the queue is cut so the index always fits. */
+  size_t const room = sizeof(workerName.text) - 1U - digitCount;
+  size_t length = 0U;
+  while ((length < room) && (name != nullptr) &&
+         (name[length] != static_cast<char>(0x00))) {
+    workerName.text[length] = name[length];
+    ++length;
+  }
+  while (digitCount > 0U) {
+    workerName.text[length++] = digits[--digitCount];
+  }
+  workerName.text[length] = static_cast<char>(0x00);
+  return workerName;
+}
+} // namespace RTOS
@@ -0,0 +1,166 @@
+/**
+ * @file        BinaryLogUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the records of the binary logger.
+ * @version     0.1
+ * @date        2021-08-02
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <BinaryLog.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using RTOS::BinaryLog;
+using RTOS::log_site_s;
+using RTOS::LogFormat::record_e;
+
+namespace {
+
+/**
+ * @brief   Takes every record out of the log, the start record is skipped.
+ */
+std::vector<uint8_t> drain_log() {
+  std::vector<uint8_t> bytes;
+  uint8_t buffer[RTOS::LogFormat::MAX_FORMAT_SIZE];
+  size_t length = 0U;
+  while ((length = BinaryLog::get_Instance().read(buffer, sizeof(buffer))) >
+         0U) {
+    bytes.insert(bytes.end(), buffer, buffer + length);
+  }
+  if (!bytes.empty() &&
+      (bytes[0] == static_cast<uint8_t>(record_e::eStart))) {
+    bytes.erase(bytes.begin(), bytes.begin() + RTOS::LogFormat::START_SIZE);
+  }
+  return bytes;
+}
+
+template <typename T> T value_at(std::vector<uint8_t> const &rBytes,
+                                 size_t const offset) {
+  T value{};
+  std::memcpy(&value, &rBytes[offset], sizeof(value));
+  return value;
+}
+
+/**
+ * @brief   Sum of the dropped reports in records of narrow arguments only.
+ */
+uint32_t count_dropped(std::vector<uint8_t> const &rBytes) {
+  uint32_t dropped = 0U;
+  size_t offset = 0U;
+  while (offset < rBytes.size()) {
+    switch (static_cast<record_e>(rBytes[offset])) {
+    case record_e::eFormat:
+      offset += RTOS::LogFormat::FORMAT_HEADER_SIZE + rBytes[offset + 1U];
+      break;
+    case record_e::eLine:
+      offset += RTOS::LogFormat::LINE_HEADER_SIZE +
+                (rBytes[offset + 1U] * RTOS::LogFormat::NARROW_ARG_SIZE);
+      break;
+    case record_e::eDropped:
+      dropped += value_at<uint32_t>(rBytes, offset + 1U);
+      offset += RTOS::LogFormat::DROPPED_SIZE;
+      break;
+    default:
+      ADD_FAILURE() << "Unexpected record at " << offset;
+      return dropped;
+    }
+  }
+  return dropped;
+}
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(BinaryLogPositive, FirstLineSendsFormatThenLine) {
+  (void)drain_log();
+  static log_site_s site;
+  char const *const pFormat = "value %d of %u";
+
+  ASSERT_TRUE(BinaryLog::get_Instance().write(site, pFormat, -5, 7U));
+  std::vector<uint8_t> const bytes = drain_log();
+
+  size_t const formatLength = std::strlen(pFormat);
+  size_t const lineOffset = RTOS::LogFormat::FORMAT_HEADER_SIZE + formatLength;
+  ASSERT_EQ(bytes.size(), lineOffset + RTOS::LogFormat::LINE_HEADER_SIZE + 8U);
+
+  EXPECT_EQ(bytes[0], static_cast<uint8_t>(record_e::eFormat));
+  EXPECT_EQ(bytes[1], formatLength);
+  uint32_t const id = value_at<uint32_t>(bytes, 2U);
+  EXPECT_NE(id, 0U);
+  EXPECT_EQ(std::string(reinterpret_cast<char const *>(&bytes[6]),
+                        formatLength),
+            pFormat);
+
+  EXPECT_EQ(bytes[lineOffset], static_cast<uint8_t>(record_e::eLine));
+  EXPECT_EQ(bytes[lineOffset + 1U], 2U);
+  EXPECT_EQ(bytes[lineOffset + 2U], 0U);
+  EXPECT_EQ(value_at<uint32_t>(bytes, lineOffset + 3U), id);
+  EXPECT_EQ(value_at<int32_t>(bytes, lineOffset + 11U), -5);
+  EXPECT_EQ(value_at<uint32_t>(bytes, lineOffset + 15U), 7U);
+}
+
+TEST(BinaryLogPositive, NextLineSendsOnlyTheLine) {
+  (void)drain_log();
+  static log_site_s site;
+
+  ASSERT_TRUE(BinaryLog::get_Instance().write(site, "tick"));
+  (void)drain_log();
+  ASSERT_TRUE(BinaryLog::get_Instance().write(site, "tick"));
+  std::vector<uint8_t> const bytes = drain_log();
+
+  ASSERT_EQ(bytes.size(), RTOS::LogFormat::LINE_HEADER_SIZE);
+  EXPECT_EQ(bytes[0], static_cast<uint8_t>(record_e::eLine));
+  EXPECT_EQ(value_at<uint32_t>(bytes, 3U), site.id.load());
+}
+
+TEST(BinaryLogPositive, WideArgumentsAreMarked) {
+  (void)drain_log();
+  static log_site_s site;
+
+  ASSERT_TRUE(BinaryLog::get_Instance().write(site, "%u %f %llu", 1U, 2.5F,
+                                              uint64_t{1} << 40U));
+  std::vector<uint8_t> const bytes = drain_log();
+  size_t const lineOffset = bytes.size() - (RTOS::LogFormat::LINE_HEADER_SIZE +
+                                            4U + 8U + 8U);
+
+  EXPECT_EQ(bytes[lineOffset + 1U], 3U);
+  EXPECT_EQ(bytes[lineOffset + 2U], 0x06U);
+  EXPECT_EQ(value_at<uint32_t>(bytes, lineOffset + 11U), 1U);
+  EXPECT_EQ(value_at<double>(bytes, lineOffset + 15U), 2.5);
+  EXPECT_EQ(value_at<uint64_t>(bytes, lineOffset + 23U), uint64_t{1} << 40U);
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(BinaryLogNegative, FullLogDropsAndReportsTheCount) {
+  (void)drain_log();
+  static log_site_s site;
+  BinaryLog &rLog = BinaryLog::get_Instance();
+  uint32_t const droppedBefore = rLog.get_dropped();
+
+  size_t written = 0U;
+  while (rLog.write(site, "fill %u", 0U)) {
+    ++written;
+  }
+  ASSERT_GT(written, 0U);
+  ASSERT_FALSE(rLog.write(site, "fill %u", 0U));
+  EXPECT_EQ(rLog.get_dropped(), droppedBefore + 2U);
+
+  /* A report may fit in the full log before the next line is dropped. */
+  uint32_t reported = count_dropped(drain_log());
+  ASSERT_TRUE(rLog.write(site, "fill %u", 0U));
+  std::vector<uint8_t> const bytes = drain_log();
+  reported += count_dropped(bytes);
+
+  EXPECT_EQ(reported, 2U);
+  ASSERT_GE(bytes.size(), RTOS::LogFormat::LINE_HEADER_SIZE + 4U);
+  EXPECT_EQ(bytes[bytes.size() - (RTOS::LogFormat::LINE_HEADER_SIZE + 4U)],
+            static_cast<uint8_t>(record_e::eLine));
+}
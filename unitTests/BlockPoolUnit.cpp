@@ -0,0 +1,168 @@
+/**
+ * @file        BlockPoolUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the block pool handles and the zero-copy block queue.
+ * @version     0.1
+ * @date        2021-08-04
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <BlockQueue.hpp>
+
+#include <utility>
+
+constexpr size_t POOL_SIZE = 2U;
+
+struct frame_s {
+  uint32_t sequence;
+  uint8_t payload[12];
+};
+
+using pool_t = RTOS::BlockPool<frame_s, POOL_SIZE>;
+using queue_t = RTOS::BlockQueue<frame_s, POOL_SIZE>;
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(BlockPoolPositive, HandleReleasesTheBlockOnDestruction) {
+  pool_t pool;
+  {
+    pool_t::Handle first = pool.acquire(RTOS::delay_t(0U));
+    pool_t::Handle second = pool.acquire(RTOS::delay_t(0U));
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_NE(first.get(), second.get());
+  }
+
+  /* Both blocks are back, so the pool hands out both again. */
+  pool_t::Handle first = pool.acquire(RTOS::delay_t(0U));
+  pool_t::Handle second = pool.acquire(RTOS::delay_t(0U));
+  EXPECT_TRUE(first);
+  EXPECT_TRUE(second);
+}
+
+TEST(BlockPoolPositive, MoveTransfersTheBlock) {
+  pool_t pool;
+  pool_t::Handle source = pool.acquire(RTOS::delay_t(0U));
+  frame_s *const pBlock = source.get();
+  ASSERT_NE(pBlock, nullptr);
+
+  pool_t::Handle moved(std::move(source));
+  EXPECT_FALSE(source);
+  EXPECT_EQ(moved.get(), pBlock);
+
+  pool_t::Handle assigned;
+  assigned = std::move(moved);
+  EXPECT_FALSE(moved);
+  EXPECT_EQ(assigned.get(), pBlock);
+}
+
+TEST(BlockPoolPositive, MoveAssignmentReturnsTheOwnedBlock) {
+  pool_t pool;
+  pool_t::Handle first = pool.acquire(RTOS::delay_t(0U));
+  pool_t::Handle second = pool.acquire(RTOS::delay_t(0U));
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  /* The block of first goes back to the pool. */
+  first = std::move(second);
+  pool_t::Handle third = pool.acquire(RTOS::delay_t(0U));
+  EXPECT_TRUE(third);
+  EXPECT_NE(third.get(), first.get());
+}
+
+TEST(BlockPoolPositive, ReleasedBlockIsAdoptedBack) {
+  pool_t pool;
+  pool_t::Handle handle = pool.acquire(RTOS::delay_t(0U));
+  frame_s *const pBlock = handle.release();
+  EXPECT_FALSE(handle);
+
+  pool_t::Handle adopted = pool.adopt(pBlock);
+  EXPECT_EQ(adopted.get(), pBlock);
+}
+
+TEST(BlockQueuePositive, OwnershipPassesThroughTheQueue) {
+  pool_t pool;
+  queue_t queue(pool);
+
+  pool_t::Handle sent = pool.acquire(RTOS::delay_t(0U));
+  ASSERT_TRUE(sent);
+  frame_s *const pBlock = sent.get();
+  sent->sequence = 42U;
+
+  ASSERT_EQ(queue.send(sent, RTOS::delay_t(0U)), RTOS::RET_STA_E::eRTOSSuccess);
+  EXPECT_FALSE(sent);
+
+  /* Same block, read in place. */
+  pool_t::Handle received = queue.receive(RTOS::delay_t(0U));
+  ASSERT_TRUE(received);
+  EXPECT_EQ(received.get(), pBlock);
+  EXPECT_EQ(received->sequence, 42U);
+}
+
+TEST(BlockQueuePositive, ReceivedBlockGoesBackToThePool) {
+  pool_t pool;
+  queue_t queue(pool);
+
+  for (size_t round = 0U; round < (2U * POOL_SIZE); ++round) {
+    pool_t::Handle sent = pool.acquire(RTOS::delay_t(0U));
+    ASSERT_TRUE(sent);
+    ASSERT_EQ(queue.send(sent, RTOS::delay_t(0U)),
+              RTOS::RET_STA_E::eRTOSSuccess);
+    /* Dropping the received handle frees the block for the next round. */
+    EXPECT_TRUE(queue.receive(RTOS::delay_t(0U)));
+  }
+}
+
+TEST(BlockQueuePositive, UnreceivedBlocksGoBackWithTheQueue) {
+  pool_t pool;
+  {
+    queue_t queue(pool);
+    for (size_t index = 0U; index < POOL_SIZE; ++index) {
+      pool_t::Handle sent = pool.acquire(RTOS::delay_t(0U));
+      ASSERT_EQ(queue.send(sent, RTOS::delay_t(0U)),
+                RTOS::RET_STA_E::eRTOSSuccess);
+    }
+    EXPECT_FALSE(pool.acquire(RTOS::delay_t(0U)));
+  }
+
+  EXPECT_TRUE(pool.acquire(RTOS::delay_t(0U)));
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(BlockPoolNegative, ExhaustedPoolGivesAnEmptyHandle) {
+  pool_t pool;
+  pool_t::Handle first = pool.acquire(RTOS::delay_t(0U));
+  pool_t::Handle second = pool.acquire(RTOS::delay_t(0U));
+
+  pool_t::Handle third = pool.acquire(RTOS::delay_t(0U));
+  EXPECT_FALSE(third);
+  EXPECT_EQ(third.get(), nullptr);
+}
+
+TEST(BlockQueueNegative, EmptyHandleIsNotSent) {
+  pool_t pool;
+  queue_t queue(pool);
+  pool_t::Handle empty;
+
+  EXPECT_EQ(queue.send(empty, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+  EXPECT_FALSE(queue.receive(RTOS::delay_t(0U)));
+}
+
+TEST(BlockQueueNegative, FullQueueKeepsTheBlockWithTheSender) {
+  pool_t pool;
+  RTOS::BlockQueue<frame_s, POOL_SIZE, 1U> queue(pool);
+  pool_t::Handle first = pool.acquire(RTOS::delay_t(0U));
+  pool_t::Handle second = pool.acquire(RTOS::delay_t(0U));
+
+  ASSERT_EQ(queue.send(first, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+  EXPECT_EQ(queue.send(second, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+  EXPECT_TRUE(second);
+}
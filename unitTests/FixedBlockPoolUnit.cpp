@@ -0,0 +1,309 @@
+/**
+ * @file        FixedBlockPoolUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the fixed size block pool and the pooled paths of the
+ * memory manager.
+ * @version     0.1
+ * @date        2021-08-05
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <FixedBlockPool.hpp>
+#include <MemoryManager.hpp>
+
+#include <cstdint>
+
+/* Pools of the linked wrappers, see unitTestConfiguration.cmake. */
+#ifndef RTOS_MEM_TASK_CB_POOL_COUNT
+#define RTOS_MEM_TASK_CB_POOL_COUNT 0
+#endif
+#ifndef RTOS_MEM_QUEUE_CB_POOL_COUNT
+#define RTOS_MEM_QUEUE_CB_POOL_COUNT 0
+#endif
+#ifndef RTOS_MEM_SMALL_BLOCK_SIZE
+#define RTOS_MEM_SMALL_BLOCK_SIZE 32
+#endif
+#ifndef RTOS_MEM_SMALL_BLOCK_COUNT
+#define RTOS_MEM_SMALL_BLOCK_COUNT 0
+#endif
+#ifndef RTOS_MEM_MEDIUM_BLOCK_SIZE
+#define RTOS_MEM_MEDIUM_BLOCK_SIZE 128
+#endif
+#ifndef RTOS_MEM_MEDIUM_BLOCK_COUNT
+#define RTOS_MEM_MEDIUM_BLOCK_COUNT 0
+#endif
+#ifndef RTOS_MEM_LARGE_BLOCK_SIZE
+#define RTOS_MEM_LARGE_BLOCK_SIZE 512
+#endif
+#ifndef RTOS_MEM_LARGE_BLOCK_COUNT
+#define RTOS_MEM_LARGE_BLOCK_COUNT 0
+#endif
+
+using RTOS::FixedBlockPool;
+using RTOS::MemoryManager;
+using RTOS::mem_category_e;
+
+constexpr size_t BLOCK_SIZE = 20U;
+constexpr size_t BLOCK_COUNT = 3U;
+
+struct test_pool_s {
+  alignas(portBYTE_ALIGNMENT) uint8_t
+      arena[FixedBlockPool::block_size_for(BLOCK_SIZE) * BLOCK_COUNT];
+  FixedBlockPool pool{arena, BLOCK_SIZE, BLOCK_COUNT};
+};
+
+namespace {
+size_t free_heap() { return MemoryManager::get_heap_stats().free_bytes; }
+
+size_t current_bytes(mem_category_e const category) {
+  return MemoryManager::get_Instance().get_usage(category).current_bytes;
+}
+
+/* Block size of the smallest configured class fitting the size, 0 if none. */
+constexpr size_t size_class_of(size_t const size) {
+  size_t const sizes[] = {RTOS_MEM_SMALL_BLOCK_SIZE, RTOS_MEM_MEDIUM_BLOCK_SIZE,
+                          RTOS_MEM_LARGE_BLOCK_SIZE};
+  size_t const counts[] = {RTOS_MEM_SMALL_BLOCK_COUNT,
+                           RTOS_MEM_MEDIUM_BLOCK_COUNT,
+                           RTOS_MEM_LARGE_BLOCK_COUNT};
+  for (size_t index = 0U; index < 3U; ++index) {
+    size_t const blockSize = FixedBlockPool::block_size_for(sizes[index]);
+    if ((counts[index] > 0U) && (size <= blockSize)) {
+      return blockSize;
+    }
+  }
+  return 0U;
+}
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(FixedBlockPoolPositive, BlockSizeIsRoundedToTheAlignment) {
+  /* A block holds at least the link of the free list. */
+  EXPECT_GE(FixedBlockPool::block_size_for(1U), sizeof(void *));
+  EXPECT_EQ(FixedBlockPool::block_size_for(1U) % portBYTE_ALIGNMENT, 0U);
+  EXPECT_EQ(FixedBlockPool::block_size_for(portBYTE_ALIGNMENT),
+            static_cast<size_t>(portBYTE_ALIGNMENT));
+  EXPECT_EQ(FixedBlockPool::block_size_for(portBYTE_ALIGNMENT + 1U),
+            static_cast<size_t>(2U * portBYTE_ALIGNMENT));
+
+  test_pool_s test;
+  EXPECT_EQ(test.pool.block_size(), FixedBlockPool::block_size_for(BLOCK_SIZE));
+}
+
+TEST(FixedBlockPoolPositive, HandsOutDistinctAlignedBlocksOfTheArena) {
+  test_pool_s test;
+  void *pBlocks[BLOCK_COUNT] = {};
+
+  for (void *&pBlock : pBlocks) {
+    pBlock = test.pool.allocate();
+    ASSERT_NE(pBlock, nullptr);
+    EXPECT_TRUE(test.pool.owns(pBlock));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pBlock) % portBYTE_ALIGNMENT, 0U);
+  }
+  EXPECT_NE(pBlocks[0], pBlocks[1]);
+  EXPECT_NE(pBlocks[1], pBlocks[2]);
+  EXPECT_NE(pBlocks[0], pBlocks[2]);
+}
+
+TEST(FixedBlockPoolPositive, ReleasedBlockIsReused) {
+  test_pool_s test;
+  void *const pFirst = test.pool.allocate();
+  void *const pSecond = test.pool.allocate();
+  ASSERT_NE(pFirst, nullptr);
+  ASSERT_NE(pSecond, nullptr);
+
+  /* The last released block is handed out first. */
+  test.pool.release(pFirst);
+  test.pool.release(pSecond);
+  EXPECT_EQ(test.pool.allocate(), pSecond);
+  EXPECT_EQ(test.pool.allocate(), pFirst);
+}
+
+TEST(FixedBlockPoolPositive, ReleasedBlockServesAnExhaustedPool) {
+  test_pool_s test;
+  void *pBlocks[BLOCK_COUNT] = {};
+  for (void *&pBlock : pBlocks) {
+    pBlock = test.pool.allocate();
+  }
+  ASSERT_EQ(test.pool.allocate(), nullptr);
+
+  test.pool.release(pBlocks[1]);
+  EXPECT_EQ(test.pool.allocate(), pBlocks[1]);
+}
+
+TEST(MemoryManagerPoolPositive, ControlBlocksComeFromTheirPools) {
+  if (RTOS_MEM_TASK_CB_POOL_COUNT == 0 || RTOS_MEM_QUEUE_CB_POOL_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+  size_t const usageBefore = current_bytes(mem_category_e::eControlBlockMemory);
+
+  StaticTask_t *pTCB = nullptr;
+  StaticQueue_t *pQCB = nullptr;
+  ASSERT_EQ(rManager.get_CB(&pTCB), RTOS::eMemAllocationSuccess);
+  ASSERT_EQ(rManager.get_CB(&pQCB), RTOS::eMemAllocationSuccess);
+
+  /* The pools are outside of the heap and are accounted by the block size. */
+  EXPECT_EQ(free_heap(), heapBefore);
+  EXPECT_EQ(current_bytes(mem_category_e::eControlBlockMemory),
+            usageBefore + FixedBlockPool::block_size_for(sizeof(StaticTask_t)) +
+                FixedBlockPool::block_size_for(sizeof(StaticQueue_t)));
+
+  MemoryManager::release_CB(pTCB);
+  MemoryManager::release_CB(pQCB);
+  EXPECT_EQ(free_heap(), heapBefore);
+  EXPECT_EQ(current_bytes(mem_category_e::eControlBlockMemory), usageBefore);
+}
+
+TEST(MemoryManagerPoolPositive, BlockComesFromTheSmallestFittingClass) {
+  if (RTOS_MEM_SMALL_BLOCK_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+  size_t const usageBefore = current_bytes(mem_category_e::eBlockMemory);
+
+  void *pBlock = nullptr;
+  ASSERT_EQ(rManager.get_block(&pBlock, 1U), RTOS::eMemAllocationSuccess);
+  EXPECT_EQ(free_heap(), heapBefore);
+  EXPECT_EQ(current_bytes(mem_category_e::eBlockMemory),
+            usageBefore +
+                FixedBlockPool::block_size_for(RTOS_MEM_SMALL_BLOCK_SIZE));
+
+  MemoryManager::release_block(pBlock);
+  EXPECT_EQ(current_bytes(mem_category_e::eBlockMemory), usageBefore);
+}
+
+TEST(MemoryManagerPoolPositive, StackComesFromAPool) {
+  if (RTOS_MEM_LARGE_BLOCK_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+
+  RTOS::stack_t pStack = nullptr;
+  ASSERT_EQ(rManager.get_stack(pStack, RTOS_MEM_LARGE_BLOCK_SIZE /
+                                           sizeof(StackType_t)),
+            RTOS::eMemAllocationSuccess);
+  EXPECT_EQ(free_heap(), heapBefore);
+
+  MemoryManager::release_stack(pStack);
+  EXPECT_EQ(free_heap(), heapBefore);
+}
+
+TEST(MemoryManagerPoolPositive, ExhaustedSizeClassFallsToTheNextClass) {
+  if (RTOS_MEM_SMALL_BLOCK_COUNT == 0 || RTOS_MEM_MEDIUM_BLOCK_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+  void *pBlocks[RTOS_MEM_SMALL_BLOCK_COUNT + 1U] = {};
+
+  for (void *&pBlock : pBlocks) {
+    ASSERT_EQ(rManager.get_block(&pBlock, RTOS_MEM_SMALL_BLOCK_SIZE),
+              RTOS::eMemAllocationSuccess);
+  }
+
+  /* The small blocks are all taken, the last one is a medium block. */
+  EXPECT_EQ(free_heap(), heapBefore);
+
+  size_t const usageBefore = current_bytes(mem_category_e::eBlockMemory);
+  MemoryManager::release_block(pBlocks[RTOS_MEM_SMALL_BLOCK_COUNT]);
+  EXPECT_EQ(current_bytes(mem_category_e::eBlockMemory),
+            usageBefore -
+                FixedBlockPool::block_size_for(RTOS_MEM_MEDIUM_BLOCK_SIZE));
+
+  for (size_t index = 0U; index < RTOS_MEM_SMALL_BLOCK_COUNT; ++index) {
+    MemoryManager::release_block(pBlocks[index]);
+  }
+}
+
+TEST(MemoryManagerPoolPositive, ExhaustedPoolsFallBackToTheHeap) {
+  if (RTOS_MEM_LARGE_BLOCK_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+  void *pBlocks[RTOS_MEM_LARGE_BLOCK_COUNT + 1U] = {};
+
+  /* Only the large class fits, the block after the last large one is from
+   * the heap. */
+  for (void *&pBlock : pBlocks) {
+    ASSERT_EQ(rManager.get_block(&pBlock, RTOS_MEM_LARGE_BLOCK_SIZE),
+              RTOS::eMemAllocationSuccess);
+  }
+  EXPECT_LT(free_heap(), heapBefore);
+
+  for (void *pBlock : pBlocks) {
+    MemoryManager::release_block(pBlock);
+  }
+  EXPECT_EQ(free_heap(), heapBefore);
+}
+
+TEST(MemoryManagerPoolPositive, ExhaustedCBPoolFallsBackToTheBlocks) {
+  if (RTOS_MEM_QUEUE_CB_POOL_COUNT == 0) {
+    GTEST_SKIP();
+  }
+  MemoryManager &rManager = MemoryManager::get_Instance();
+  size_t const heapBefore = free_heap();
+  StaticQueue_t *pCBs[RTOS_MEM_QUEUE_CB_POOL_COUNT + 1U] = {};
+
+  for (StaticQueue_t *&pCB : pCBs) {
+    ASSERT_EQ(rManager.get_CB(&pCB), RTOS::eMemAllocationSuccess);
+  }
+
+  /* The CB after the last pooled one is served like any other block. */
+  size_t const usageBefore = current_bytes(mem_category_e::eControlBlockMemory);
+  size_t const blockSize = size_class_of(sizeof(StaticQueue_t));
+  if (blockSize > 0U) {
+    EXPECT_EQ(free_heap(), heapBefore);
+  } else {
+    EXPECT_LT(free_heap(), heapBefore);
+  }
+  MemoryManager::release_CB(pCBs[RTOS_MEM_QUEUE_CB_POOL_COUNT]);
+  if (blockSize > 0U) {
+    EXPECT_EQ(current_bytes(mem_category_e::eControlBlockMemory),
+              usageBefore - blockSize);
+  }
+
+  for (size_t index = 0U; index < RTOS_MEM_QUEUE_CB_POOL_COUNT; ++index) {
+    MemoryManager::release_CB(pCBs[index]);
+  }
+  EXPECT_EQ(free_heap(), heapBefore);
+}
+
+/*------------------- Negative Tests ------------------*/
+
+TEST(FixedBlockPoolNegative, ExhaustedPoolReturnsNull) {
+  test_pool_s test;
+  for (size_t index = 0U; index < BLOCK_COUNT; ++index) {
+    ASSERT_NE(test.pool.allocate(), nullptr);
+  }
+
+  EXPECT_EQ(test.pool.allocate(), nullptr);
+  EXPECT_EQ(test.pool.allocate(), nullptr);
+}
+
+TEST(FixedBlockPoolNegative, DoesNotOwnMemoryOutsideTheArena) {
+  test_pool_s test;
+  int outside = 0;
+
+  EXPECT_FALSE(test.pool.owns(&outside));
+  EXPECT_FALSE(test.pool.owns(nullptr));
+  EXPECT_FALSE(test.pool.owns(test.arena + sizeof(test.arena)));
+  EXPECT_TRUE(test.pool.owns(&test.arena[sizeof(test.arena) - 1U]));
+}
+
+TEST(FixedBlockPoolNegative, EmptyPoolHandsOutNothing) {
+  alignas(portBYTE_ALIGNMENT) uint8_t arena[1];
+  FixedBlockPool pool(arena, BLOCK_SIZE, 0U);
+
+  EXPECT_EQ(pool.allocate(), nullptr);
+  EXPECT_FALSE(pool.owns(arena));
+}
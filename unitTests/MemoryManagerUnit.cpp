@@ -11,6 +11,15 @@
 #include "MemoryManagerMock.hpp"
 #include "kernel_helpers.hpp"
 
+// Number of blocks in all the pools, see unitTestConfiguration.cmake.
+#if defined(RTOS_MEM_TASK_CB_POOL_COUNT) && defined(RTOS_MEM_SMALL_BLOCK_COUNT)
+#define RTOS_MEM_POOLED_BLOCKS                                                 \
+  (RTOS_MEM_TASK_CB_POOL_COUNT + RTOS_MEM_SMALL_BLOCK_COUNT +                  \
+   RTOS_MEM_MEDIUM_BLOCK_COUNT + RTOS_MEM_LARGE_BLOCK_COUNT)
+#else
+#define RTOS_MEM_POOLED_BLOCKS 0
+#endif
+
 /*
 ==========================:Example test format:===========================
 TEST(MemoryManagerTestPositive, AllocatingStack){
@@ -63,7 +72,125 @@ TEST(MemoryManagerTestPositive, AllocatingByte) {
   MemoryManagerMock::get_Instance().release_block(p_Block);
 }
 
+TEST(MemoryManagerTestPositive, UsageFollowsTheBlocks) {
+
+  RTOS::MemoryManager &rManager = MemoryManagerMock::get_Instance();
+  RTOS::mem_usage_s const before =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  void *p_Block;
+  ASSERT_EQ(rManager.get_block(&p_Block, 1000),
+            RTOS::eMemoryResult::eMemAllocationSuccess);
+
+  RTOS::mem_usage_s const taken =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  EXPECT_GE(taken.current_bytes, before.current_bytes + 1000);
+  EXPECT_EQ(taken.allocation_count, before.allocation_count + 1);
+  EXPECT_EQ(taken.failed_allocations, before.failed_allocations);
+  EXPECT_GE(taken.peak_bytes, taken.current_bytes);
+
+  rManager.release_block(p_Block);
+  RTOS::mem_usage_s const given =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  EXPECT_EQ(given.current_bytes, before.current_bytes);
+  EXPECT_EQ(given.allocation_count, taken.allocation_count);
+  EXPECT_EQ(given.peak_bytes, taken.peak_bytes);
+}
+
+TEST(MemoryManagerTestPositive, UsageFollowsTheControlBlocks) {
+
+  RTOS::MemoryManager &rManager = MemoryManagerMock::get_Instance();
+  RTOS::mem_usage_s const before =
+      rManager.get_usage(RTOS::mem_category_e::eControlBlockMemory);
+  RTOS::mem_usage_s const blocksBefore =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  RTOS::control_block_t TCB;
+  ASSERT_EQ(rManager.get_CB(&TCB), RTOS::eMemoryResult::eMemAllocationSuccess);
+
+  RTOS::mem_usage_s const taken =
+      rManager.get_usage(RTOS::mem_category_e::eControlBlockMemory);
+  EXPECT_GE(taken.current_bytes, before.current_bytes + sizeof(StaticTask_t));
+  EXPECT_EQ(taken.allocation_count, before.allocation_count + 1);
+  EXPECT_GE(taken.peak_bytes, taken.current_bytes);
+  // Other categories are not touched.
+  EXPECT_EQ(rManager.get_usage(RTOS::mem_category_e::eBlockMemory)
+                .allocation_count,
+            blocksBefore.allocation_count);
+
+  rManager.release_CB(TCB);
+  EXPECT_EQ(rManager.get_usage(RTOS::mem_category_e::eControlBlockMemory)
+                .current_bytes,
+            before.current_bytes);
+}
+
+TEST(MemoryManagerTestPositive, PeakBytesKeepsTheHighWaterMark) {
+
+  RTOS::MemoryManager &rManager = MemoryManagerMock::get_Instance();
+  RTOS::mem_usage_s const before =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  // Going above the earlier peak so the peak is set by this test.
+  size_t const size = (before.peak_bytes - before.current_bytes) + 1000;
+  void *p_First;
+  void *p_Second;
+  ASSERT_EQ(rManager.get_block(&p_First, size),
+            RTOS::eMemoryResult::eMemAllocationSuccess);
+  ASSERT_EQ(rManager.get_block(&p_Second, 1000),
+            RTOS::eMemoryResult::eMemAllocationSuccess);
+  RTOS::mem_usage_s const highest =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  EXPECT_GT(highest.peak_bytes, before.peak_bytes);
+  EXPECT_EQ(highest.peak_bytes, highest.current_bytes);
+
+  rManager.release_block(p_First);
+  rManager.release_block(p_Second);
+  ASSERT_EQ(rManager.get_block(&p_Second, 1000),
+            RTOS::eMemoryResult::eMemAllocationSuccess);
+  RTOS::mem_usage_s const lower =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  EXPECT_LT(lower.current_bytes, highest.current_bytes);
+  EXPECT_EQ(lower.peak_bytes, highest.peak_bytes);
+  rManager.release_block(p_Second);
+}
+
+TEST(MemoryManagerTestPositive, HeapStatsFollowTheHeap) {
+
+  RTOS::MemoryManager &rManager = MemoryManagerMock::get_Instance();
+  RTOS::heap_stats_s const before = RTOS::MemoryManager::get_heap_stats();
+  EXPECT_LE(before.min_ever_free_bytes, before.free_bytes);
+  EXPECT_LE(before.largest_free_block, before.free_bytes);
+  EXPECT_LE(before.free_bytes, static_cast<size_t>(configTOTAL_HEAP_SIZE));
+
+  // Bigger than any pooled block so it comes from the heap.
+  void *p_Block;
+  ASSERT_EQ(rManager.get_block(&p_Block, 4000),
+            RTOS::eMemoryResult::eMemAllocationSuccess);
+  RTOS::heap_stats_s const taken = RTOS::MemoryManager::get_heap_stats();
+  EXPECT_LE(taken.free_bytes, before.free_bytes - 4000);
+  EXPECT_LE(taken.min_ever_free_bytes, taken.free_bytes);
+
+  rManager.release_block(p_Block);
+  RTOS::heap_stats_s const given = RTOS::MemoryManager::get_heap_stats();
+  EXPECT_EQ(given.free_bytes, before.free_bytes);
+  // The low-water mark of the heap is kept after the release.
+  EXPECT_LE(given.min_ever_free_bytes, taken.free_bytes);
+}
+
 /*------------------- Negative Tests ------------------*/
+TEST(MemoryManagerTestNegative, FailedAllocationIsCounted) {
+
+  RTOS::MemoryManager &rManager = MemoryManagerMock::get_Instance();
+  RTOS::mem_usage_s const before =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  void *p_Block;
+  ASSERT_EQ(rManager.get_block(&p_Block, 24 * 10000),
+            RTOS::eMemoryResult::eMemAllocationFailed);
+
+  RTOS::mem_usage_s const after =
+      rManager.get_usage(RTOS::mem_category_e::eBlockMemory);
+  EXPECT_EQ(after.failed_allocations, before.failed_allocations + 1);
+  EXPECT_EQ(after.allocation_count, before.allocation_count);
+  EXPECT_EQ(after.current_bytes, before.current_bytes);
+}
+
 TEST(MemoryManagerTestNegative, UnableToAllocateStack) {
 
   RTOS::stack_t stack;
@@ -83,7 +210,13 @@ TEST(MemoryManagerTestNegative, UnableToAllocateTask) {
                 reinterpret_cast<void **>(&p_Temp), configTOTAL_HEAP_SIZE - 32),
             RTOS::eMemoryResult::eMemAllocationSuccess);
   RTOS::control_block_t TCB; // Trying to reserve memory when not available.
-  RTOS::eMemoryResult res = MemoryManagerMock::get_Instance().get_CB(&TCB);
+  RTOS::eMemoryResult res = RTOS::eMemoryResult::eMemAllocationSuccess;
+  // Pooled blocks are outside the heap, they run out before the CB fails.
+  for (size_t i = 0; (i <= RTOS_MEM_POOLED_BLOCKS) &&
+                     (res == RTOS::eMemoryResult::eMemAllocationSuccess);
+       ++i) {
+    res = MemoryManagerMock::get_Instance().get_CB(&TCB);
+  }
 
   ASSERT_EQ(res, RTOS::eMemoryResult::eMemAllocationFailed);
 }
@@ -0,0 +1,129 @@
+/**
+ * @file        QueueBatchUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the batch enqueue and dequeue of the queues.
+ * @version     0.1
+ * @date        2021-08-04
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <Queue.hpp>
+#include <TQueue.hpp>
+
+constexpr size_t QUEUE_LENGTH = 4U;
+
+using queue_t = RTOS::TQueue<uint32_t, QUEUE_LENGTH>;
+
+namespace {
+
+#ifdef POSIX_SIM
+/**
+ * @brief   Makes the calls in its scope take the ISR flavour, like an ISR of
+ * the simulator.
+ */
+struct simulated_isr {
+  simulated_isr() { xSimInsideInterrupt = pdTRUE; }
+  ~simulated_isr() { xSimInsideInterrupt = pdFALSE; }
+};
+#endif
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(QueueBatchPositive, WholeBatchKeepsTheOrder) {
+  queue_t queue;
+  uint32_t const items[] = {1U, 2U, 3U};
+  uint32_t received[QUEUE_LENGTH] = {};
+
+  EXPECT_EQ(queue.enqueue_n(items, 3U, RTOS::delay_t(0U)), 3U);
+  EXPECT_EQ(queue.dequeue_n(received, QUEUE_LENGTH, RTOS::delay_t(0U)), 3U);
+  EXPECT_EQ(received[0], 1U);
+  EXPECT_EQ(received[1], 2U);
+  EXPECT_EQ(received[2], 3U);
+}
+
+TEST(QueueBatchPositive, PartialBatchMovesWhatFits) {
+  queue_t queue;
+  uint32_t const items[] = {1U, 2U, 3U, 4U, 5U, 6U};
+  uint32_t received[2] = {};
+
+  EXPECT_EQ(queue.enqueue_n(items, 6U, RTOS::delay_t(0U)), QUEUE_LENGTH);
+
+  /* Only as many as asked for are taken, the rest stays queued. */
+  EXPECT_EQ(queue.dequeue_n(received, 2U, RTOS::delay_t(0U)), 2U);
+  EXPECT_EQ(received[1], 2U);
+  EXPECT_EQ(queue.dequeue_n(received, 2U, RTOS::delay_t(0U)), 2U);
+  EXPECT_EQ(received[0], 3U);
+  EXPECT_EQ(received[1], 4U);
+}
+
+TEST(QueueBatchPositive, UntypedQueueMovesBatches) {
+  RTOS::Queue queue(QUEUE_LENGTH, sizeof(uint16_t));
+  uint16_t const items[] = {10U, 20U};
+  uint16_t received[2] = {};
+
+  EXPECT_EQ(queue.enqueue_n(items, 2U, RTOS::delay_t(0U)), 2U);
+  EXPECT_EQ(queue.dequeue_n(received, 2U, RTOS::delay_t(0U)), 2U);
+  EXPECT_EQ(received[1], 20U);
+}
+
+#ifdef POSIX_SIM
+TEST(QueueBatchPositive, IsrBatchWithoutWait) {
+  queue_t queue;
+  uint32_t const items[] = {7U, 8U, 9U};
+  uint32_t received[3] = {};
+
+  {
+    simulated_isr isr;
+    EXPECT_EQ(queue.enqueue_n(items, 3U, RTOS::delay_t(0U)), 3U);
+    EXPECT_EQ(queue.dequeue_n(received, 3U, RTOS::delay_t(0U)), 3U);
+  }
+  EXPECT_EQ(received[2], 9U);
+}
+#endif
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(QueueBatchNegative, FullQueueTakesNothing) {
+  queue_t queue;
+  uint32_t const items[QUEUE_LENGTH] = {};
+
+  ASSERT_EQ(queue.enqueue_n(items, QUEUE_LENGTH, RTOS::delay_t(0U)),
+            QUEUE_LENGTH);
+  EXPECT_EQ(queue.enqueue_n(items, 2U, RTOS::delay_t(0U)), 0U);
+}
+
+TEST(QueueBatchNegative, ZeroWaitOnEmptyQueueReceivesNothing) {
+  queue_t queue;
+  uint32_t received[2] = {};
+
+  EXPECT_EQ(queue.dequeue_n(received, 2U, RTOS::delay_t(0U)), 0U);
+}
+
+TEST(QueueBatchNegative, EmptyBatchMovesNothing) {
+  queue_t queue;
+  uint32_t item = 1U;
+
+  EXPECT_EQ(queue.enqueue_n(&item, 0U, RTOS::delay_t(0U)), 0U);
+  ASSERT_EQ(queue.enqueue(item, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+  EXPECT_EQ(queue.dequeue_n(&item, 0U, RTOS::delay_t(0U)), 0U);
+}
+
+#ifdef POSIX_SIM
+TEST(QueueBatchNegative, IsrBatchWithWaitIsRefused) {
+  queue_t queue;
+  uint32_t item = 1U;
+  ASSERT_EQ(queue.enqueue(item, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+
+  simulated_isr isr;
+  /* An ISR cannot block, a batch asking to wait moves nothing. */
+  EXPECT_EQ(queue.enqueue_n(&item, 1U, RTOS::delay_t::from_ticks(1U)), 0U);
+  EXPECT_EQ(queue.dequeue_n(&item, 1U, RTOS::delay_t::from_ticks(1U)), 0U);
+}
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file        ScopedLockUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the lock guards.
+ * @version     0.1
+ * @date        2021-07-30
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "MockMutex.hpp"
+#include <ScopedLock.hpp>
+
+#include <utility>
+
+using namespace NEST_TESTS;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(ScopedLockPositive, LocksForeverAndUnlocksAtScopeEnd) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::wait_forever)).WillOnce(Return(true));
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+
+  RTOS::ScopedLock lock(mutex);
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(ScopedLockPositive, AdoptsLockedMutex) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+
+  RTOS::ScopedLock lock(mutex, RTOS::adopt_lock);
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(UniqueLockPositive, TimedLock) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::delay_t(10U))).WillOnce(Return(true));
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+
+  RTOS::UniqueLock lock(mutex, RTOS::delay_t(10U));
+  EXPECT_TRUE(lock);
+}
+
+TEST(UniqueLockPositive, DeferThenTryLock) {
+  StrictMock<MockMutex> mutex;
+  RTOS::UniqueLock lock(mutex, RTOS::defer_lock);
+  EXPECT_FALSE(lock.owns_lock());
+
+  EXPECT_CALL(mutex, lock(RTOS::delay_t(0U))).WillOnce(Return(true));
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+  EXPECT_TRUE(lock.try_lock());
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(UniqueLockPositive, UnlockEarlyDoesNotUnlockAgain) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::wait_forever)).WillOnce(Return(true));
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+
+  RTOS::UniqueLock lock(mutex);
+  EXPECT_TRUE(lock.unlock());
+  EXPECT_FALSE(lock.owns_lock());
+}
+
+TEST(UniqueLockPositive, MoveTransfersOwnership) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::wait_forever)).WillOnce(Return(true));
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+
+  RTOS::UniqueLock first(mutex);
+  RTOS::UniqueLock second(std::move(first));
+  EXPECT_FALSE(first.owns_lock());
+  EXPECT_EQ(first.mutex(), nullptr);
+  EXPECT_TRUE(second.owns_lock());
+  EXPECT_EQ(second.mutex(), &mutex);
+
+  RTOS::UniqueLock third;
+  third = std::move(second);
+  EXPECT_TRUE(third.owns_lock());
+  EXPECT_FALSE(second.owns_lock());
+}
+
+TEST(UniqueLockPositive, ReleaseKeepsMutexLocked) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::wait_forever)).WillOnce(Return(true));
+
+  RTOS::IMutex *pMutex = nullptr;
+  {
+    RTOS::UniqueLock lock(mutex);
+    pMutex = lock.release();
+  }
+  EXPECT_EQ(pMutex, &mutex);
+
+  EXPECT_CALL(mutex, unlock()).WillOnce(Return(true));
+  EXPECT_TRUE(pMutex->unlock());
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(UniqueLockNegative, FailedTryLockDoesNotUnlock) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::delay_t(0U))).WillOnce(Return(false));
+
+  RTOS::UniqueLock lock(mutex, RTOS::try_to_lock);
+  EXPECT_FALSE(lock.owns_lock());
+  EXPECT_FALSE(lock);
+}
+
+TEST(ScopedLockNegative, FailedLockDoesNotUnlock) {
+  StrictMock<MockMutex> mutex;
+  EXPECT_CALL(mutex, lock(RTOS::wait_forever)).WillOnce(Return(false));
+
+  RTOS::ScopedLock lock(mutex);
+  EXPECT_FALSE(lock.owns_lock());
+}
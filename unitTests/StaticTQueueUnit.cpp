@@ -0,0 +1,128 @@
+/**
+ * @file        StaticTQueueUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the templated queue with in-object storage.
+ * @version     0.1
+ * @date        2021-08-05
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <StaticTQueue.hpp>
+
+constexpr size_t QUEUE_LENGTH = 4U;
+
+struct reading_s {
+  uint32_t timestamp;
+  int16_t value;
+};
+
+using static_queue_t = RTOS::StaticTQueue<reading_s, QUEUE_LENGTH>;
+
+namespace {
+/**
+ * @brief   Allocations of the memory manager and the state of the heap, to
+ * tell if anything was taken from them.
+ */
+struct memory_snapshot_s {
+  RTOS::mem_usage_s control_blocks;
+  RTOS::mem_usage_s blocks;
+  size_t free_heap;
+
+  static memory_snapshot_s take() {
+    RTOS::MemoryManager &rManager = RTOS::MemoryManager::get_Instance();
+    return {rManager.get_usage(RTOS::mem_category_e::eControlBlockMemory),
+            rManager.get_usage(RTOS::mem_category_e::eBlockMemory),
+            RTOS::MemoryManager::get_heap_stats().free_bytes};
+  }
+};
+
+void expect_untouched(memory_snapshot_s const &rBefore) {
+  memory_snapshot_s const after = memory_snapshot_s::take();
+  EXPECT_EQ(after.control_blocks.allocation_count,
+            rBefore.control_blocks.allocation_count);
+  EXPECT_EQ(after.control_blocks.current_bytes,
+            rBefore.control_blocks.current_bytes);
+  EXPECT_EQ(after.blocks.allocation_count, rBefore.blocks.allocation_count);
+  EXPECT_EQ(after.blocks.current_bytes, rBefore.blocks.current_bytes);
+  EXPECT_EQ(after.free_heap, rBefore.free_heap);
+}
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(StaticTQueuePositive, DoesNotTouchTheMemoryManager) {
+  memory_snapshot_s const before = memory_snapshot_s::take();
+  {
+    static_queue_t queue;
+    expect_untouched(before);
+  }
+
+  /* Nothing is given back on the destruction either. */
+  expect_untouched(before);
+}
+
+TEST(StaticTQueuePositive, ItemsMakeTheRoundTrip) {
+  static_queue_t queue;
+  reading_s received = {};
+
+  for (uint32_t index = 0U; index < QUEUE_LENGTH; ++index) {
+    ASSERT_EQ(queue.enqueue(reading_s{index, static_cast<int16_t>(index * 10U)},
+                            RTOS::delay_t(0U)),
+              RTOS::RET_STA_E::eRTOSSuccess);
+  }
+  for (uint32_t index = 0U; index < QUEUE_LENGTH; ++index) {
+    ASSERT_EQ(queue.dequeue(received, RTOS::delay_t(0U)),
+              RTOS::RET_STA_E::eRTOSSuccess);
+    EXPECT_EQ(received.timestamp, index);
+    EXPECT_EQ(received.value, static_cast<int16_t>(index * 10U));
+  }
+}
+
+TEST(StaticTQueuePositive, QueueIsUsableAfterAnEarlierOneIsDestroyed) {
+  {
+    static_queue_t queue;
+    queue.enqueue(reading_s{1U, 1});
+  }
+
+  /* The items of the destroyed queue are gone with it. */
+  static_queue_t queue;
+  reading_s received = {};
+  EXPECT_FALSE(queue.try_dequeue(received));
+  queue.enqueue(reading_s{2U, 2});
+  EXPECT_TRUE(queue.try_dequeue(received));
+  EXPECT_EQ(received.timestamp, 2U);
+}
+
+TEST(StaticTQueuePositive, HeapQueueUsesTheMemoryManager) {
+  memory_snapshot_s const before = memory_snapshot_s::take();
+  {
+    RTOS::TQueue<reading_s, QUEUE_LENGTH> queue;
+    memory_snapshot_s const during = memory_snapshot_s::take();
+    EXPECT_EQ(during.control_blocks.allocation_count,
+              before.control_blocks.allocation_count + 1U);
+    EXPECT_EQ(during.blocks.allocation_count,
+              before.blocks.allocation_count + 1U);
+  }
+
+  memory_snapshot_s const after = memory_snapshot_s::take();
+  EXPECT_EQ(after.control_blocks.current_bytes,
+            before.control_blocks.current_bytes);
+  EXPECT_EQ(after.blocks.current_bytes, before.blocks.current_bytes);
+}
+
+/*------------------- Negative Tests ------------------*/
+
+TEST(StaticTQueueNegative, FullQueueRefusesTheItem) {
+  static_queue_t queue;
+  for (uint32_t index = 0U; index < QUEUE_LENGTH; ++index) {
+    ASSERT_EQ(queue.enqueue(reading_s{index, 0}, RTOS::delay_t(0U)),
+              RTOS::RET_STA_E::eRTOSSuccess);
+  }
+
+  EXPECT_EQ(queue.enqueue(reading_s{QUEUE_LENGTH, 0}, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+}
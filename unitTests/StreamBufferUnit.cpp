@@ -0,0 +1,80 @@
+/**
+ * @file        StreamBufferUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the capacity of the stream and the message buffers.
+ * @version     0.1
+ * @date        2021-08-04
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <StreamBuffer.hpp>
+
+constexpr size_t BUFFER_SIZE = 8U;
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(StreamBufferPositive, HoldsExactlyItsSize) {
+  RTOS::StreamBuffer<BUFFER_SIZE> stream;
+  uint8_t const bytes[BUFFER_SIZE] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+
+  ASSERT_TRUE(stream.is_created());
+  EXPECT_EQ(stream.space(), BUFFER_SIZE);
+  EXPECT_EQ(stream.send(bytes, sizeof(bytes)), BUFFER_SIZE);
+  EXPECT_TRUE(stream.is_full());
+  EXPECT_EQ(stream.space(), 0U);
+  EXPECT_EQ(stream.available(), BUFFER_SIZE);
+
+  uint8_t read[BUFFER_SIZE] = {};
+  EXPECT_EQ(stream.receive(read, sizeof(read), RTOS::delay_t(0U)),
+            BUFFER_SIZE);
+  EXPECT_EQ(read[BUFFER_SIZE - 1U], 8U);
+  EXPECT_TRUE(stream.is_empty());
+}
+
+TEST(StreamBufferPositive, TriggerLevelOfTheWholeSizeFires) {
+  RTOS::StreamBuffer<BUFFER_SIZE> stream(BUFFER_SIZE);
+  uint8_t const byte = 0x5AU;
+
+  ASSERT_TRUE(stream.is_created());
+  EXPECT_TRUE(stream.set_trigger_level(BUFFER_SIZE));
+  for (size_t index = 0U; index < BUFFER_SIZE; ++index) {
+    ASSERT_EQ(stream.send(&byte, 1U), 1U);
+  }
+
+  /* The last byte reaches the level, a reader waiting on it gets them all. */
+  uint8_t read[BUFFER_SIZE] = {};
+  EXPECT_EQ(stream.receive(read, sizeof(read), RTOS::delay_t(0U)),
+            BUFFER_SIZE);
+}
+
+TEST(MessageBufferPositive, MessageOfTheWholeSizeFits) {
+  using messages_t = RTOS::MessageBuffer<BUFFER_SIZE + sizeof(size_t)>;
+  messages_t messages;
+  uint8_t const message[BUFFER_SIZE] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+
+  ASSERT_TRUE(messages.is_created());
+  EXPECT_TRUE(messages.send(message, sizeof(message)));
+  EXPECT_TRUE(messages.is_full());
+  EXPECT_EQ(messages.next_size(), BUFFER_SIZE);
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(StreamBufferNegative, RefusesBytesOverItsSize) {
+  RTOS::StreamBuffer<BUFFER_SIZE> stream;
+  uint8_t const bytes[BUFFER_SIZE + 1U] = {};
+
+  EXPECT_EQ(stream.send(bytes, sizeof(bytes)), BUFFER_SIZE);
+  EXPECT_EQ(stream.send(bytes, 1U), 0U);
+}
+
+TEST(StreamBufferNegative, TriggerLevelOverTheSizeIsRefused) {
+  RTOS::StreamBuffer<BUFFER_SIZE> stream;
+
+  EXPECT_FALSE(stream.set_trigger_level(BUFFER_SIZE + 1U));
+  EXPECT_FALSE(stream.set_trigger_level(0U));
+}
@@ -0,0 +1,175 @@
+/**
+ * @file        TQueueUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the typed enqueue, dequeue and peek of the TQueue.
+ * @version     0.1
+ * @date        2021-08-05
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <TQueue.hpp>
+
+#include <optional>
+#include <type_traits>
+
+constexpr size_t QUEUE_LENGTH = 3U;
+
+/**
+ * @brief   Item that can only be made from its values.
+ */
+struct sample_s {
+  sample_s(uint16_t const channel, int32_t const value)
+      : channel(channel), value(value) {}
+
+  uint16_t channel;
+  int32_t value;
+};
+
+static_assert(!std::is_default_constructible_v<sample_s>,
+              "The test needs an item without a default constructor.");
+
+using queue_t = RTOS::TQueue<uint32_t, QUEUE_LENGTH>;
+using sample_queue_t = RTOS::TQueue<sample_s, QUEUE_LENGTH>;
+
+namespace {
+
+#ifdef POSIX_SIM
+/**
+ * @brief   Makes the calls in its scope take the ISR flavour, like an ISR of
+ * the simulator.
+ */
+struct simulated_isr {
+  simulated_isr() { xSimInsideInterrupt = pdTRUE; }
+  ~simulated_isr() { xSimInsideInterrupt = pdFALSE; }
+};
+#endif
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(TQueuePositive, TypedItemsKeepTheOrder) {
+  queue_t queue;
+  uint32_t item = 0U;
+
+  EXPECT_EQ(queue.enqueue(1U, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+  queue.enqueue(2U);
+  EXPECT_EQ(queue.dequeue(item, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+  EXPECT_EQ(item, 1U);
+  queue.dequeue(item);
+  EXPECT_EQ(item, 2U);
+}
+
+TEST(TQueuePositive, EnqueueToFrontIsReceivedFirst) {
+  queue_t queue;
+  uint32_t item = 0U;
+
+  queue.enqueue(1U);
+  EXPECT_EQ(queue.enqueue_to_front(2U, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSSuccess);
+  queue.enqueue_to_front(3U);
+
+  queue.dequeue(item);
+  EXPECT_EQ(item, 3U);
+  queue.dequeue(item);
+  EXPECT_EQ(item, 2U);
+  queue.dequeue(item);
+  EXPECT_EQ(item, 1U);
+}
+
+TEST(TQueuePositive, PeekLeavesTheItemQueued) {
+  queue_t queue;
+  uint32_t item = 0U;
+  queue.enqueue(7U);
+
+  EXPECT_EQ(queue.peek(item, RTOS::delay_t(0U)), RTOS::RET_STA_E::eRTOSSuccess);
+  EXPECT_EQ(item, 7U);
+  item = 0U;
+  queue.peek(item);
+  EXPECT_EQ(item, 7U);
+
+  EXPECT_TRUE(queue.try_dequeue(item));
+  EXPECT_EQ(item, 7U);
+}
+
+TEST(TQueuePositive, OptionalDequeueReturnsTheItem) {
+  queue_t queue;
+  queue.enqueue(5U);
+
+  std::optional<uint32_t> const item = queue.dequeue(RTOS::wait_forever);
+  ASSERT_TRUE(item.has_value());
+  EXPECT_EQ(*item, 5U);
+
+  queue.enqueue(6U);
+  std::optional<uint32_t> const next = queue.try_dequeue();
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ(*next, 6U);
+}
+
+TEST(TQueuePositive, ItemNeedsNoDefaultConstructor) {
+  sample_queue_t queue;
+  queue.enqueue(sample_s(1U, -10));
+  queue.enqueue_to_front(sample_s(2U, 20));
+
+  sample_s peeked(0U, 0);
+  queue.peek(peeked);
+  EXPECT_EQ(peeked.channel, 2U);
+
+  std::optional<sample_s> const first = queue.dequeue(RTOS::wait_forever);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->channel, 2U);
+  EXPECT_EQ(first->value, 20);
+
+  std::optional<sample_s> const second = queue.dequeue(RTOS::wait_forever);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(second->channel, 1U);
+  EXPECT_EQ(second->value, -10);
+}
+
+/*------------------- Negative Tests ------------------*/
+
+TEST(TQueueNegative, FullQueueRefusesTheItem) {
+  queue_t queue;
+  for (uint32_t index = 0U; index < QUEUE_LENGTH; ++index) {
+    ASSERT_EQ(queue.enqueue(index, RTOS::delay_t(0U)),
+              RTOS::RET_STA_E::eRTOSSuccess);
+  }
+
+  EXPECT_EQ(queue.enqueue(9U, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+  EXPECT_EQ(queue.enqueue_to_front(9U, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+}
+
+TEST(TQueueNegative, EmptyQueueLeavesTheItemUntouched) {
+  queue_t queue;
+  uint32_t item = 3U;
+
+  EXPECT_EQ(queue.dequeue(item, RTOS::delay_t(0U)),
+            RTOS::RET_STA_E::eRTOSFailure);
+  EXPECT_EQ(queue.peek(item, RTOS::delay_t(0U)), RTOS::RET_STA_E::eRTOSFailure);
+  EXPECT_FALSE(queue.try_dequeue(item));
+  EXPECT_EQ(item, 3U);
+}
+
+TEST(TQueueNegative, OptionalDequeueTimesOutOnAnEmptyQueue) {
+  sample_queue_t queue;
+
+  EXPECT_FALSE(queue.dequeue(RTOS::delay_t::from_ticks(1U)).has_value());
+  EXPECT_FALSE(queue.try_dequeue().has_value());
+}
+
+#ifdef POSIX_SIM
+TEST(TQueueNegative, OptionalDequeueInAnIsrIsEmptyOnAnEmptyQueue) {
+  sample_queue_t queue;
+
+  /* An ISR cannot wait, so waiting forever fails at once. */
+  simulated_isr isr;
+  EXPECT_FALSE(queue.dequeue(RTOS::wait_forever).has_value());
+}
+#endif
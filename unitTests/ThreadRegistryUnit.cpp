@@ -0,0 +1,101 @@
+/**
+ * @file        ThreadRegistryUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the thread registry.
+ * @version     0.1
+ * @date        2021-07-29
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include "ThreadMock.hpp"
+#include <ThreadRegistry.hpp>
+
+#include <cstring>
+
+using namespace TEST;
+
+constexpr priority_t TaskPriority = 1;
+constexpr stack_size_t TaskStackSize = 100;
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(ThreadRegistryPositive, AssignsUniqueIds) {
+  ThreadMock first("UTRegOne", TaskPriority, TaskStackSize);
+  ThreadMock second("UTRegTwo", TaskPriority, TaskStackSize);
+  ThreadMock third("UTRegThree", TaskPriority, TaskStackSize);
+
+  ASSERT_NE(first.get_id(), ThreadRegistry::INVALID_ID);
+  ASSERT_NE(first.get_id(), second.get_id());
+  ASSERT_NE(second.get_id(), third.get_id());
+  ASSERT_NE(first.get_id(), third.get_id());
+
+  ThreadRegistry &rRegistry = ThreadRegistry::get_Instance();
+  EXPECT_EQ(rRegistry.find(first.get_id()), &first);
+  EXPECT_EQ(rRegistry.find(second.get_id()), &second);
+  EXPECT_EQ(rRegistry.find(third.get_id()), &third);
+}
+
+TEST(ThreadRegistryPositive, FindsThreadByName) {
+  ThreadMock first("UTRegOne", TaskPriority, TaskStackSize);
+  ThreadMock second("UTRegTwo", TaskPriority, TaskStackSize);
+
+  ThreadRegistry &rRegistry = ThreadRegistry::get_Instance();
+  EXPECT_EQ(rRegistry.find("UTRegTwo"), &second);
+  EXPECT_EQ(rRegistry.find("UTRegOne"), &first);
+  EXPECT_STREQ(first.get_name(), "UTRegOne");
+}
+
+TEST(ThreadRegistryPositive, TruncatesLongNamesLikeTheKernel) {
+  ThreadMock thread("UTRegistryWithALongName", TaskPriority, TaskStackSize);
+
+  EXPECT_EQ(std::strlen(thread.get_name()), configMAX_TASK_NAME_LEN - 1U);
+  EXPECT_EQ(ThreadRegistry::get_Instance().find("UTRegistryWithALongName"),
+            &thread);
+}
+
+TEST(ThreadRegistryPositive, RecyclesIdOfDestroyedThread) {
+  RTOS::id_t released_id = ThreadRegistry::INVALID_ID;
+  {
+    ThreadMock thread("UTRegOld", TaskPriority, TaskStackSize);
+    released_id = thread.get_id();
+  }
+  EXPECT_EQ(ThreadRegistry::get_Instance().find(released_id), nullptr);
+  EXPECT_EQ(ThreadRegistry::get_Instance().find("UTRegOld"), nullptr);
+
+  ThreadMock thread("UTRegNew", TaskPriority, TaskStackSize);
+  EXPECT_EQ(thread.get_id(), released_id);
+}
+
+TEST(ThreadRegistryPositive, EntryKeepsTheNameWhenTheIdIsReused) {
+  RTOS::thread_entry_s entry{};
+  {
+    ThreadMock thread("UTRegOld", TaskPriority, TaskStackSize);
+    ASSERT_TRUE(ThreadRegistry::get_Instance().get_entry(thread.get_id(),
+                                                         entry));
+  }
+  ThreadMock thread("UTRegNew", TaskPriority, TaskStackSize);
+
+  /* The copy is not touched, the thread has its name in its own TCB. */
+  EXPECT_STREQ(entry.name, "UTRegOld");
+  EXPECT_STREQ(thread.get_name(), "UTRegNew");
+}
+
+TEST(ThreadRegistryPositive, HonoursRequestedId) {
+  constexpr RTOS::id_t RequestedId = ThreadRegistry::MAX_THREADS;
+  ThreadMock thread("UTRegFixed", TaskPriority, TaskStackSize, RequestedId);
+
+  EXPECT_EQ(thread.get_id(), RequestedId);
+  EXPECT_EQ(ThreadRegistry::get_Instance().find(RequestedId), &thread);
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(ThreadRegistryNegative, ReplacesTakenRequestedId) {
+  ThreadMock first("UTRegOne", TaskPriority, TaskStackSize);
+  ThreadMock second("UTRegTwo", TaskPriority, TaskStackSize, first.get_id());
+
+  EXPECT_NE(second.get_id(), ThreadRegistry::INVALID_ID);
+  EXPECT_NE(second.get_id(), first.get_id());
+}
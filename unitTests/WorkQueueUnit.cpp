@@ -0,0 +1,81 @@
+/**
+ * @file        WorkQueueUnit.cpp
+ * @author      Manish Tummala (manish.tummala@gmail.com)
+ * @brief       Tests for the jobs and the worker names of the work queue.
+ * @version     0.1
+ * @date        2021-08-03
+ *
+ * @copyright   Copyright (c) 2020
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <WorkQueue.hpp>
+
+#include <cstring>
+#include <string>
+
+using RTOS::Job;
+
+namespace {
+
+/**
+ * @brief   Reaches the worker naming of the work queue.
+ */
+struct worker_name_probe : RTOS::WorkQueueBase {
+  using RTOS::WorkQueueBase::make_worker_name;
+};
+} // namespace
+
+/*-------------- Positive Tests ----------------*/
+
+TEST(WorkQueuePositive, JobRunsItsCapturedValues) {
+  uint32_t total = 0U;
+  uint32_t *const pTotal = &total;
+  uint32_t const value = 7U;
+
+  Job const job([pTotal, value] { *pTotal += value; });
+  job();
+  job();
+
+  EXPECT_FALSE(job.is_empty());
+  EXPECT_EQ(total, 14U);
+}
+
+TEST(WorkQueuePositive, CopiedJobRunsLikeTheOriginal) {
+  uint32_t total = 0U;
+  uint32_t *const pTotal = &total;
+
+  Job const job([pTotal] { ++(*pTotal); });
+  /* The queue copies a job byte by byte. */
+  Job copy;
+  std::memcpy(static_cast<void *>(&copy), &job, sizeof(copy));
+  copy();
+
+  EXPECT_EQ(total, 1U);
+}
+
+TEST(WorkQueuePositive, WorkerNameEndsWithTheIndex) {
+  EXPECT_EQ(std::string(worker_name_probe::make_worker_name("Pool", 0U).text),
+            "Pool0");
+  EXPECT_EQ(std::string(worker_name_probe::make_worker_name("Pool", 12U).text),
+            "Pool12");
+}
+
+/*-------------- Negative Tests ----------------*/
+
+TEST(WorkQueueNegative, EmptyJobDoesNothing) {
+  Job const job;
+
+  EXPECT_TRUE(job.is_empty());
+  job();
+}
+
+TEST(WorkQueueNegative, LongNameIsCutToFitTheIndex) {
+  std::string const name =
+      worker_name_probe::make_worker_name("AVeryLongQueueName", 3U).text;
+
+  EXPECT_EQ(name.size(), configMAX_TASK_NAME_LEN - 1U);
+  EXPECT_EQ(name.back(), '3');
+}
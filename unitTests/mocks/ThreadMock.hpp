@@ -31,8 +31,8 @@ class ThreadMock : public Thread {
 
 public:
   ThreadMock(name_t thread_name, priority_t thread_priority,
-             stack_size_t stack_size)
-      : Thread(thread_name, thread_priority, stack_size) {}
+             stack_size_t stack_size, RTOS::id_t thread_id = 0)
+      : Thread(thread_name, thread_priority, stack_size, thread_id) {}
 
   return_status_e thread_delete() override {
     Thread::~Thread();